@@ -0,0 +1,74 @@
+#This script checks the constructor table (init array) of a linked ELF image.
+#Every entry must resolve to an address inside an executable section, otherwise the
+#startup code would call a NULL or invalid constructor. With a checked image the
+#runtime NULL check of STARTUP_v_RunCtors can be disabled (STARTUP_CTOR_CHECK_NULL).
+#Usage: check_init_array.py <image.elf> [--relative] [--section NAME] [--skip-first-last]
+import argparse
+import struct
+import sys
+
+SHF_EXECINSTR = 0x4
+
+#function to read the section headers of a 32 bit little endian ELF file
+def readSections(data):
+  if data[0:4] != b"\x7fELF" or data[4] != 1 or data[5] != 1:
+    raise ValueError("only 32 bit little endian ELF files are supported")
+  shoff, = struct.unpack_from("<I", data, 0x20)
+  shentsize, shnum, shstrndx = struct.unpack_from("<HHH", data, 0x2E)
+  sections = []
+  for i in range(shnum):
+    name, stype, flags, addr, offset, size = struct.unpack_from("<IIIIII", data, shoff + i * shentsize)
+    sections.append({"name": name, "type": stype, "flags": flags, "addr": addr, "offset": offset, "size": size})
+  strtab = sections[shstrndx]
+  for sec in sections:
+    start = strtab["offset"] + sec["name"]
+    sec["name"] = data[start:data.index(b"\0", start)].decode()
+  return sections
+
+#function to check if an address is inside an executable section
+def isCode(sections, addr):
+  for sec in sections:
+    if (sec["flags"] & SHF_EXECINSTR) and sec["addr"] <= addr < sec["addr"] + sec["size"]:
+      return True
+  return False
+
+def main():
+  parser = argparse.ArgumentParser(description="Check the init array of a linked image")
+  parser.add_argument("elf", help="linked ELF image")
+  parser.add_argument("--section", default=None, help="name of the init array section (default: .init_array or INIT_ARRAY)")
+  parser.add_argument("--relative", action="store_true", help="entries are offsets relative to the entry (ARM linker)")
+  parser.add_argument("--skip-first-last", action="store_true", help="ignore first and last entry (TI ctordtor.o)")
+  args = parser.parse_args()
+
+  with open(args.elf, "rb") as f:
+    data = f.read()
+  sections = readSections(data)
+
+  names = [args.section] if args.section else [".init_array", "INIT_ARRAY"]
+  table = [sec for sec in sections if sec["name"] in names]
+  if not table:
+    print("no init array section found, nothing to check")
+    return 0
+  table = table[0]
+
+  count = table["size"] // 4
+  first = 1 if args.skip_first_last else 0
+  last = count - 1 if args.skip_first_last else count
+  errors = 0
+  for i in range(first, last):
+    value, = struct.unpack_from("<I", data, table["offset"] + 4 * i)
+    if args.relative:
+      target = (table["addr"] + 4 * i + struct.unpack("<i", struct.pack("<I", value))[0]) & 0xFFFFFFFF
+      valid = value != 0 and isCode(sections, target & ~1)
+    else:
+      target = value
+      valid = isCode(sections, target & ~1)
+    if not valid:
+      print("init array entry %d (0x%08X) points to invalid address 0x%08X" % (i, table["addr"] + 4 * i, target))
+      errors += 1
+
+  print("%s: %d constructors, %d invalid" % (table["name"], max(last - first, 0), errors))
+  return 1 if errors else 0
+
+if __name__ == "__main__":
+  sys.exit(main())
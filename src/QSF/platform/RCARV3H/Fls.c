@@ -7,6 +7,10 @@
 
 #include <Fls.h>
 #include <pal_qsf.h>
+#include <Fls_Partition.h>
+#include <Fls_Vector.h>
+#include <sys_mem.h>
+#include <sys_time.h>
 #ifdef QSF_ENTER_CRITICAL_SECTION
  #ifdef QSF_EXIT_CRITICAL_SECTION
   #include <Os.h>
@@ -28,6 +32,43 @@ extern "C"
 #define QSF_EXIT_CRITICAL_SECTION
 #endif
 
+// development error handling
+#ifndef QSF_DET_REPORT_ERROR
+/// reporting a development error, e.g. with Det_ReportError(), api: QSF_DET_API_xxx, err: QSF_DET_E_xxx
+#define QSF_DET_REPORT_ERROR(api, err)
+#endif
+
+// time budget of one Fls_MainFunction call
+#ifndef QSF_MAIN_BUDGET_SLOW_US
+/// time in us one Fls_MainFunction call may spend on further chunks in MEMIF_MODE_SLOW, 0: one chunk per call
+#define QSF_MAIN_BUDGET_SLOW_US 0u
+#endif
+#ifndef QSF_MAIN_BUDGET_FAST_US
+/// time in us one Fls_MainFunction call may spend on further chunks in MEMIF_MODE_FAST, 0: one chunk per call
+#define QSF_MAIN_BUDGET_FAST_US 0u
+#endif
+
+// cancel of a running write/erase
+#ifndef QSF_CANCEL_TIMEOUT_US
+/// time in us the SDF may need to finish the software reset after an aborted write/erase
+#define QSF_CANCEL_TIMEOUT_US 20000u
+#endif
+#ifndef QSF_CANCEL_READY_US
+/// time in us the SDF ignores commands after the software reset of an aborted page program (tREADY2),
+/// waited before the status is read for the first time
+#define QSF_CANCEL_READY_US 310u
+#endif
+
+// read-ahead of sequential reads
+#ifndef QSF_READ_AHEAD
+/// prefetch the data behind a sequential read stream while the module is idle (STD_ON) or not (STD_OFF)
+#define QSF_READ_AHEAD STD_OFF
+#endif
+#ifndef QSF_READ_AHEAD_SIZE
+/// size of one of the two read-ahead buffers in bytes
+#define QSF_READ_AHEAD_SIZE 0x1000u
+#endif
+
 
 #ifdef EB_MEMMAP_USE
 #define FLS_START_SEC_VAR_NO_INIT_UNSPECIFIED
@@ -45,6 +86,48 @@ volatile tQsfState sQsf;
 #define FLS_STOP_SEC_VAR_NO_INIT_UNSPECIFIED
 #include "Fls_MemMap.h"
 #endif
+
+/// registered partition handles
+static tFlsPartition* ap_QsfPartitions[QSF_PARTITION_MAX];
+/// number of registered partition handles
+static uint8 u_QsfPartitionCount;
+/// index of the partition handle checked first for the next job (round robin)
+static uint8 u_QsfPartitionNext;
+/// partition handle whose job is running, NULL for jobs of the Fls_xxx API
+static tFlsPartition* p_QsfActivePartition;
+/// configuration selected before the partition job was started
+static const Fls_ConfigType* p_QsfSavedCfg;
+/// job result of the Fls_xxx API before the partition job was started
+static MemIf_JobResultType u_QsfSavedJobStatus;
+/// next region of the running scatter-gather job
+static const tFlsVector* p_QsfVector;
+/// number of regions of the running scatter-gather job not started yet
+static uint32 u_QsfVectorLeft;
+
+static boolean b_QsfNextVector(void);
+static boolean b_QsfPartIsOpen(const tFlsPartition* p_Part, uint8 u_Api);
+static Std_ReturnType u_QsfStartVector(tQsfJob u_Job, const tFlsVector* p_Vec, uint32 u_Count);
+
+#if (QSF_READ_AHEAD == STD_ON)
+/// read-ahead buffer
+typedef struct
+{
+  uint32 u_Addr;                      ///< flash address of the buffered data
+  uint32 u_Len;                       ///< number of valid bytes, 0 if the buffer is empty
+  uint8 au_Data[QSF_READ_AHEAD_SIZE]; ///< buffered data
+} tQsfReadAhead;
+
+/// double buffer of the read-ahead
+static tQsfReadAhead as_QsfReadAhead[2];
+/// flash address behind the last read chunk
+static uint32 u_QsfReadEnd;
+/// TRUE if the last read job continued the previous one
+static boolean b_QsfReadStream;
+
+static void v_QsfReadAheadInvalidate(void);
+static void v_QsfReadAheadTrack(uint32 u_Addr);
+static boolean b_QsfReadAheadStep(void);
+#endif
 // local functions
 
 // @brief               Helper function to calculate size to be written next
@@ -203,6 +286,34 @@ static Std_ReturnType u_Qsf_GetLock(void);
 //               <a href="linkURL">link text</a>
 static void v_Qsf_Unlock(void);
 
+// @brief               Helper function to perform one step of the current job.
+//
+// @pre                 u_Qsf_GetLock is called by Fls_MainFunction.
+// @post                At most one PAL operation of the current job is started or finished.
+// @param[in]           void
+// @return              TRUE if another step in the same Fls_MainFunction call can make progress, FALSE otherwise
+//
+// @globals
+//             sQsf structure which contains status information
+//
+// @InOutCorrelation
+//    Read, compare, blank check and write steps allow a further step, so these jobs are continued
+//    within the time budget (a write polls the WIP flag and programs the next page once it is cleared). \n
+//    Erase steps and finished jobs stop the loop, the erase time is far above any budget. \n
+//    With QSF_READ_AHEAD an idle step prefetches one chunk behind a sequential read stream.
+//
+// @testmethod
+// e.g. test of Input-Output-Correlation (dynamic module test),
+//             test order of calls (dynamic module test).
+//
+// @traceability
+// Enter the link to the corresponding function in L4 design specification in Doors
+//               <a href="linkURL">link text</a>
+static boolean b_QsfMainStep(void);
+
+// time budget per MemIf mode, indexed with sQsf.Qsf_Mode
+static const uint32 au_QsfMainBudget_us[2] = { QSF_MAIN_BUDGET_SLOW_US, QSF_MAIN_BUDGET_FAST_US };
+
 // module initialisation
 void Fls_Init(const Fls_ConfigType* ConfigPtr)
 {
@@ -211,7 +322,19 @@ void Fls_Init(const Fls_ConfigType* ConfigPtr)
   {
     return;
   }
+  if (p_QsfActivePartition != NULL)
+  {
+    // the partition job would continue with the new configuration and its saved state would be lost
+    QSF_DET_REPORT_ERROR(QSF_DET_API_INIT, QSF_DET_E_BUSY);
+    v_Qsf_Unlock();
+    return;
+  }
   sQsf.u_Job = QSF_INIT;
+  u_QsfVectorLeft = 0u;
+#if (QSF_READ_AHEAD == STD_ON)
+  // the flash may have been changed by another master
+  v_QsfReadAheadInvalidate();
+#endif
 
 #if (QSF_WRITE_API == STD_ON)
   //avoid reinitialisation
@@ -264,6 +387,9 @@ Std_ReturnType Fls_Read(Fls_AddressType SourceAddress, uint8* TargetAddressPtr,
       sQsf.u_EndAddr = u_SourceAddress + Length;
       sQsf.p_CurrentRam = TargetAddressPtr;
       sQsf.u_RetVal = PAL_QSF_OK;
+#if (QSF_READ_AHEAD == STD_ON)
+      v_QsfReadAheadTrack(u_SourceAddress);
+#endif
       u_RetVal = (Std_ReturnType)(sQsf.u_RetVal);
     }
     v_Qsf_Unlock();
@@ -272,6 +398,19 @@ Std_ReturnType Fls_Read(Fls_AddressType SourceAddress, uint8* TargetAddressPtr,
   return u_RetVal;
 }
 
+// prepare scatter-gather read action
+Std_ReturnType Fls_ReadV(const tFlsVector* p_Vec, uint32 u_Count)
+{
+  Std_ReturnType u_RetVal = E_NOT_OK;
+
+  if ((p_Vec != NULL) && (u_Count != 0u))
+  {
+    u_RetVal = u_QsfStartVector(QSF_READ, p_Vec, u_Count);
+  }
+
+  return u_RetVal;
+}
+
 // prepare read action
 Std_ReturnType Fls_OTP_Read(Fls_AddressType SourceAddress, uint8* TargetAddressPtr, Fls_LengthType Length)
 {
@@ -343,6 +482,35 @@ Std_ReturnType Fls_Write(Fls_AddressType TargetAddress, const uint8* SourceAddre
   return u_RetVal;
 }
 
+// prepare scatter-gather write action
+Std_ReturnType Fls_WriteV(const tFlsVector* p_Vec, uint32 u_Count)
+{
+  Std_ReturnType u_RetVal = E_NOT_OK;
+  uint32 u_Idx;
+  uint32 u_TargetAddress;
+  const Fls_ConfigType* QsfCfg = sQsf.p_QsfCfg;
+
+  if ((p_Vec != NULL) && (u_Count != 0u))
+  {
+    u_RetVal = E_OK;
+    for (u_Idx = 0u; (u_Idx < u_Count) && (u_RetVal == E_OK); u_Idx++)
+    {
+      u_TargetAddress = p_Vec[u_Idx].u_Addr + QsfCfg->u_NvmOffset;
+      if ((u_TargetAddress < QsfCfg->u_WriteWindowStart) ||
+          (u_TargetAddress + p_Vec[u_Idx].u_Len > QsfCfg->u_WriteWindowStart + QsfCfg->u_WriteWindowSize))
+      {
+        u_RetVal = E_NOT_OK;
+      }
+    }
+  }
+  if (u_RetVal == E_OK)
+  {
+    u_RetVal = u_QsfStartVector(QSF_WRITE, p_Vec, u_Count);
+  }
+
+  return u_RetVal;
+}
+
 Std_ReturnType Fls_OTP_Write(Fls_AddressType TargetAddress, const uint8* SourceAddressPtr, Fls_LengthType Length)
 {
   Std_ReturnType u_RetVal = E_NOT_OK;
@@ -536,23 +704,59 @@ Std_ReturnType Fls_BlankCheck( Fls_AddressType TargetAddress, Fls_LengthType Len
 }
 #endif
 
-// abort action
+// helper function to cancel the running job, called with the lock held
+// a running write/erase is aborted and finished by Fls_MainFunction
+static void v_QsfCancelJob(void)
+{
+  tQsfJob u_Job = sQsf.u_Job;
+
+#if (QSF_READ_AHEAD == STD_ON)
+  // the stream ends, an aborted write/erase leaves the flash content undefined
+  v_QsfReadAheadInvalidate();
+#endif
+  if (((u_Job == QSF_WRITE) || (u_Job == QSF_ERASE) || (u_Job == QSF_ERASE_4K) || (u_Job == QSF_OTP_WRITE)) &&
+      (PAL_u_QsfIsBusy() == (Std_ReturnType)PAL_QSF_BUSY))
+  {
+    // job result stays pending until the SDF has finished the reset
+    (void)PAL_u_QsfAbort();
+    sQsf.u_Job = QSF_CANCEL;
+    sQsf.u_StartTime = SYS_TimeGetCount();
+    u_QsfVectorLeft = 0u;
+  }
+  else if ((u_Job != QSF_CANCEL) && (u_Job != QSF_CANCEL_INIT))
+  {
+    sQsf.u_QsfJobStatus = MEMIF_JOB_CANCELED;
+    sQsf.u_Job = QSF_IDLE;
+    u_QsfVectorLeft = 0u;
+    sQsf.u_QsfStatus = MEMIF_IDLE;
+  }
+  else
+  {
+    // cancel already ongoing
+  }
+}
+
+// abort action, a running partition job is canceled with Fls_u_PartCancel()
 void Fls_Cancel(void)
 {
-  Std_ReturnType u_status;
   Std_ReturnType u_lock = u_Qsf_GetLock();
 
   if (E_OK != u_lock)
   {
     return;
   }
-  do
+  if (p_QsfActivePartition != NULL)
   {
-    u_status = PAL_u_QsfIsBusy();
-  } while ( u_status == (Std_ReturnType)PAL_QSF_BUSY);
-  sQsf.u_QsfJobStatus = MEMIF_JOB_CANCELED;
-  sQsf.u_Job = QSF_IDLE;
-  sQsf.u_QsfStatus = MEMIF_IDLE;
+    // the partition job only starts with the module idle, the saved result is the one of a finished job
+    if (u_QsfSavedJobStatus == MEMIF_JOB_PENDING)
+    {
+      u_QsfSavedJobStatus = MEMIF_JOB_CANCELED;
+    }
+  }
+  else
+  {
+    v_QsfCancelJob();
+  }
   v_Qsf_Unlock();
 }
 
@@ -620,38 +824,535 @@ static void v_QsfJobEnd(void)
 {
   sQsf.u_QsfStatus = MEMIF_IDLE;  // currently sync mode
   sQsf.u_Job = QSF_IDLE;
+  u_QsfVectorLeft = 0u;
   e_Qsf_ErrorCodes RetVal = sQsf.u_RetVal;
   if (RetVal == PAL_QSF_OK)
   {
     sQsf.u_QsfJobStatus = MEMIF_JOB_OK;
 #ifdef FEE_JOB_END_NOTIFICATION
-    FEE_JOB_END_NOTIFICATION();
+    if (p_QsfActivePartition == NULL)
+    {
+      FEE_JOB_END_NOTIFICATION();
+    }
 #endif
   }
   else
   {
     sQsf.u_QsfJobStatus = MEMIF_JOB_FAILED;
 #ifdef FEE_JOB_ERROR_NOTIFICATION
-    FEE_JOB_ERROR_NOTIFICATION();
+    if (p_QsfActivePartition == NULL)
+    {
+      FEE_JOB_ERROR_NOTIFICATION();
+    }
+#endif
+  }
+}
+
+// helper function to continue a scatter-gather job with its next region
+static boolean b_QsfNextVector(void)
+{
+  boolean b_Next = FALSE;
+  uint32 u_Addr;
+
+  if (u_QsfVectorLeft != 0u)
+  {
+    u_Addr = p_QsfVector->u_Addr + sQsf.p_QsfCfg->u_NvmOffset;
+    sQsf.u_CurrentAddr = u_Addr;
+    sQsf.u_EndAddr = u_Addr + p_QsfVector->u_Len;
+    sQsf.p_CurrentRam = p_QsfVector->p_Ram;
+    // PRQA S 0491 1 // instead of pointer arithmetic: p_QsfVector++
+    p_QsfVector = &(p_QsfVector[1]);
+    u_QsfVectorLeft--;
+#if (QSF_READ_AHEAD == STD_ON)
+    if (sQsf.u_Job == QSF_READ)
+    {
+      v_QsfReadAheadTrack(u_Addr);
+    }
 #endif
+    b_Next = TRUE;
   }
+
+  return b_Next;
+}
+
+// helper function to start a scatter-gather job
+static Std_ReturnType u_QsfStartVector(tQsfJob u_Job, const tFlsVector* p_Vec, uint32 u_Count)
+{
+  Std_ReturnType u_RetVal = E_NOT_OK;
+  Std_ReturnType u_lock = u_Qsf_GetLock();
+
+  if (E_OK == u_lock)
+  {
+    MemIf_StatusType Status = sQsf.u_QsfStatus;
+    if (Status == MEMIF_IDLE)
+    {
+      sQsf.u_QsfStatus = MEMIF_BUSY;
+      sQsf.u_Job = u_Job;
+      sQsf.u_QsfJobStatus = MEMIF_JOB_PENDING;
+      sQsf.u_RetVal = PAL_QSF_OK;
+      p_QsfVector = p_Vec;
+      u_QsfVectorLeft = u_Count;
+      (void)b_QsfNextVector();
+      u_RetVal = (Std_ReturnType)(sQsf.u_RetVal);
+    }
+    v_Qsf_Unlock();
+  }
+
+  return u_RetVal;
+}
+
+#if (QSF_READ_AHEAD == STD_ON)
+// helper function to drop all read-ahead data, e.g. when the flash content changes
+static void v_QsfReadAheadInvalidate(void)
+{
+  as_QsfReadAhead[0].u_Len = 0u;
+  as_QsfReadAhead[1].u_Len = 0u;
+  u_QsfReadEnd = 0xFFFFFFFFu;
+  b_QsfReadStream = FALSE;
+}
+
+// helper function to detect a sequential read stream at the start of a read job
+static void v_QsfReadAheadTrack(uint32 u_Addr)
+{
+  b_QsfReadStream = (u_Addr == u_QsfReadEnd) ? TRUE : FALSE;
+}
+
+// helper function to read one chunk, served from the read-ahead buffers if possible
+static e_Qsf_ErrorCodes u_QsfReadChunk(uint32 u_Addr, uint8* p_Ram, uint32* p_Step)
+{
+  e_Qsf_ErrorCodes RetVal = PAL_QSF_BUSY;
+  tQsfReadAhead* p_Buf;
+  uint32 u_Avail;
+  uint32 i;
+
+  for (i = 0u; i < 2u; i++)
+  {
+    p_Buf = &as_QsfReadAhead[i];
+    if ((p_Buf->u_Len != 0u) && (u_Addr >= p_Buf->u_Addr) && ((u_Addr - p_Buf->u_Addr) < p_Buf->u_Len))
+    {
+      u_Avail = p_Buf->u_Len - (u_Addr - p_Buf->u_Addr);
+      if (*p_Step > u_Avail)
+      {
+        *p_Step = u_Avail;
+      }
+      (void)memcpy(p_Ram, &p_Buf->au_Data[u_Addr - p_Buf->u_Addr], *p_Step);
+      if (*p_Step == u_Avail)
+      {
+        p_Buf->u_Len = 0u; // consumed, free for the next prefetch
+      }
+      RetVal = PAL_QSF_OK;
+      break;
+    }
+  }
+  if (RetVal != PAL_QSF_OK)
+  {
+    // PRQA S 4342 3 // 2017-10-25; uidv7790
+    // summary: Msg(3:4342) An expression of 'essentially unsigned' type (unsigned char) is being cast to enum type 'e_Qsf_ErrorCodes'.
+    // reason: enum is used to ensure debug comfort
+    RetVal = (e_Qsf_ErrorCodes)PAL_u_QsfRead(u_Addr, p_Ram, *p_Step);
+  }
+  u_QsfReadEnd = u_Addr + *p_Step;
+  return RetVal;
+}
+
+// helper function to prefetch one chunk behind the current read stream into a read-ahead buffer,
+// called with the module idle, returns TRUE if a further chunk can be prefetched
+static boolean b_QsfReadAheadStep(void)
+{
+  uint32 u_Addr = u_QsfReadEnd;
+  tQsfReadAhead* p_Buf;
+  tQsfReadAhead* p_Fill = NULL;
+  uint32 u_Step;
+  uint32 i;
+  uint32 k;
+
+  // skip the data already buffered behind the stream
+  for (k = 0u; k < 2u; k++)
+  {
+    for (i = 0u; i < 2u; i++)
+    {
+      p_Buf = &as_QsfReadAhead[i];
+      if ((p_Buf->u_Len != 0u) && (u_Addr >= p_Buf->u_Addr) && ((u_Addr - p_Buf->u_Addr) < p_Buf->u_Len))
+      {
+        u_Addr = p_Buf->u_Addr + p_Buf->u_Len;
+      }
+    }
+  }
+  // buffers outside of [u_QsfReadEnd, u_Addr) are stale, a partly filled buffer ending at u_Addr is continued
+  for (i = 0u; i < 2u; i++)
+  {
+    p_Buf = &as_QsfReadAhead[i];
+    if ((p_Buf->u_Len == 0u) || (p_Buf->u_Addr >= u_Addr) || ((p_Buf->u_Addr + p_Buf->u_Len) <= u_QsfReadEnd))
+    {
+      p_Buf->u_Len = 0u;
+      if (p_Fill == NULL)
+      {
+        p_Fill = p_Buf;
+        p_Fill->u_Addr = u_Addr;
+      }
+    }
+    else if (((p_Buf->u_Addr + p_Buf->u_Len) == u_Addr) && (p_Buf->u_Len < QSF_READ_AHEAD_SIZE))
+    {
+      p_Fill = p_Buf;
+      break;
+    }
+    else
+    {
+      // filled, not consumed yet
+    }
+  }
+  if ((p_Fill != NULL) && (PAL_u_QsfIsBusy() == (Std_ReturnType)PAL_QSF_OK))
+  {
+    u_Step = sQsf.p_QsfCfg->ua_ReadAtOnce[sQsf.Qsf_Mode];
+    if (u_Step > (QSF_READ_AHEAD_SIZE - p_Fill->u_Len))
+    {
+      u_Step = QSF_READ_AHEAD_SIZE - p_Fill->u_Len;
+    }
+    if (PAL_u_QsfRead(u_Addr, &p_Fill->au_Data[p_Fill->u_Len], u_Step) == (Std_ReturnType)PAL_QSF_OK)
+    {
+      p_Fill->u_Len += u_Step;
+    }
+    else
+    {
+      // e.g. end of device reached, stop the stream
+      b_QsfReadStream = FALSE;
+    }
+  }
+  else
+  {
+    p_Fill = NULL;
+  }
+  return ((p_Fill != NULL) && (b_QsfReadStream == TRUE)) ? TRUE : FALSE;
+}
+#endif
+
+// helper function to switch the active configuration, the PAL only updates the partition parameters
+static e_Qsf_ErrorCodes u_QsfSelectConfig(const Fls_ConfigType* ConfigPtr)
+{
+  // PRQA S 4342 3 // 2017-10-25; uidv7790
+  // summary: Msg(3:4342) An expression of 'essentially unsigned' type (unsigned char) is being cast to enum type 'e_Qsf_ErrorCodes'.
+  // reason: enum is used to ensure debug comfort
+  e_Qsf_ErrorCodes RetVal = (e_Qsf_ErrorCodes)PAL_u_QsfInit(ConfigPtr);
+  if (RetVal == PAL_QSF_OK)
+  {
+    sQsf.p_QsfCfg = ConfigPtr;
+    sQsf.u_PageSize = PAL_u_QsfGetPageSize();
+    sQsf.u_SectorSize = PAL_u_QsfGetSectorSize();
+  }
+  return RetVal;
+}
+
+// helper function to start the queued job of a partition, called with the lock held and the module idle
+static void v_QsfStartPartition(tFlsPartition* p_Part)
+{
+  const Fls_ConfigType* p_Cfg = p_Part->p_Cfg;
+  uint32 u_Addr = p_Part->u_Addr + p_Cfg->u_NvmOffset;
+  e_Qsf_ErrorCodes RetVal = PAL_QSF_OK;
+  uint32 Sector;
+
+  p_QsfActivePartition = p_Part;
+  p_QsfSavedCfg = sQsf.p_QsfCfg;
+  u_QsfSavedJobStatus = sQsf.u_QsfJobStatus;
+  if (p_Cfg != p_QsfSavedCfg)
+  {
+    RetVal = u_QsfSelectConfig(p_Cfg);
+  }
+  Sector = sQsf.u_SectorSize;
+  if ((RetVal == PAL_QSF_OK) && (p_Part->u_Job == QSF_ERASE) &&
+      (((u_Addr & (Sector-1u)) != 0u) || ((p_Part->u_Len & (Sector-1u)) != 0u)))
+  {
+    RetVal = PAL_QSF_ERROR_ALIGN;
+  }
+
+  sQsf.u_QsfStatus = MEMIF_BUSY;
+  sQsf.u_Job = p_Part->u_Job;
+  sQsf.u_QsfJobStatus = MEMIF_JOB_PENDING;
+  sQsf.u_CurrentAddr = u_Addr;
+  sQsf.u_EndAddr = u_Addr + p_Part->u_Len;
+  sQsf.p_CurrentRam = p_Part->p_Ram;
+  sQsf.u_RetVal = RetVal;
+#if (QSF_READ_AHEAD == STD_ON)
+  if (p_Part->u_Job == QSF_READ)
+  {
+    v_QsfReadAheadTrack(u_Addr);
+  }
+#endif
+  if (RetVal != PAL_QSF_OK)
+  {
+    v_QsfJobEnd();
+  }
+}
+
+// helper function to hand over a finished partition job and to start the next queued one
+static void v_QsfSchedulePartitions(void)
+{
+  tFlsPartition* p_Part = p_QsfActivePartition;
+  uint8 u_Cnt = u_QsfPartitionCount;
+  uint8 u_Idx;
+  uint8 i;
+
+  if ((p_Part != NULL) && (sQsf.u_Job == QSF_IDLE))
+  {
+    p_Part->u_JobResult = sQsf.u_QsfJobStatus;
+    p_Part->u_Job = QSF_IDLE;
+    if ((p_QsfSavedCfg != NULL) && (p_QsfSavedCfg != sQsf.p_QsfCfg))
+    {
+      (void)u_QsfSelectConfig(p_QsfSavedCfg);
+    }
+    sQsf.u_QsfJobStatus = u_QsfSavedJobStatus;
+    p_QsfActivePartition = NULL;
+  }
+
+  if ((p_QsfActivePartition == NULL) && (sQsf.u_QsfStatus == MEMIF_IDLE))
+  {
+    for (i = 0u; i < u_Cnt; i++)
+    {
+      u_Idx = (uint8)((u_QsfPartitionNext + i) % u_Cnt);
+      p_Part = ap_QsfPartitions[u_Idx];
+      if (p_Part->u_Job != QSF_IDLE)
+      {
+        u_QsfPartitionNext = (uint8)((u_Idx + 1u) % u_Cnt);
+        v_QsfStartPartition(p_Part);
+        break;
+      }
+    }
+  }
+}
+
+// helper function to check that a handle is registered with Fls_u_PartOpen(), reports a development error if not
+static boolean b_QsfPartIsOpen(const tFlsPartition* p_Part, uint8 u_Api)
+{
+  boolean b_Open = FALSE;
+  uint8 i;
+
+  if (p_Part == NULL)
+  {
+    QSF_DET_REPORT_ERROR(u_Api, QSF_DET_E_PARAM_POINTER);
+  }
+  else
+  {
+    for (i = 0u; i < u_QsfPartitionCount; i++)
+    {
+      if (ap_QsfPartitions[i] == p_Part)
+      {
+        b_Open = TRUE;
+      }
+    }
+    if (b_Open == FALSE)
+    {
+      QSF_DET_REPORT_ERROR(u_Api, QSF_DET_E_PARAM_HANDLE);
+    }
+  }
+  return b_Open;
+}
+
+// helper function to queue a job for a registered partition
+static Std_ReturnType u_QsfPartQueue(tFlsPartition* p_Part, uint8 u_Api, tQsfJob u_Job, uint32 u_Addr, uint8* p_Ram, uint32 u_Len)
+{
+  Std_ReturnType u_RetVal = E_NOT_OK;
+
+  QSF_ENTER_CRITICAL_SECTION;
+  if ((p_Part->u_Job == QSF_IDLE) && (p_Part->u_JobResult != MEMIF_JOB_PENDING))
+  {
+    p_Part->u_Addr = u_Addr;
+    p_Part->p_Ram = p_Ram;
+    p_Part->u_Len = u_Len;
+    p_Part->u_JobResult = MEMIF_JOB_PENDING;
+    p_Part->u_Job = u_Job;
+    u_RetVal = E_OK;
+  }
+  QSF_EXIT_CRITICAL_SECTION;
+
+  if (u_RetVal != E_OK)
+  {
+    QSF_DET_REPORT_ERROR(u_Api, QSF_DET_E_BUSY);
+  }
+  return u_RetVal;
+}
+
+#if (QSF_WRITE_API == STD_ON)
+// helper function to check a range against the write window of a partition
+static boolean b_QsfPartInWindow(const tFlsPartition* p_Part, uint32 u_Addr, uint32 u_Len)
+{
+  const Fls_ConfigType* p_Cfg = p_Part->p_Cfg;
+  uint32 u_TargetAddress = u_Addr + p_Cfg->u_NvmOffset;
+
+  return ((u_TargetAddress >= p_Cfg->u_WriteWindowStart) &&
+          ((u_TargetAddress + u_Len) <= (p_Cfg->u_WriteWindowStart + p_Cfg->u_WriteWindowSize))) ? TRUE : FALSE;
+}
+#endif
+
+Std_ReturnType Fls_u_PartOpen(tFlsPartition* p_Part, const Fls_ConfigType* p_Cfg)
+{
+  Std_ReturnType u_RetVal = E_NOT_OK;
+  uint8 u_Err = QSF_DET_E_NONE;
+  uint8 i;
+
+  if ((p_Part == NULL) || (p_Cfg == NULL))
+  {
+    QSF_DET_REPORT_ERROR(QSF_DET_API_PART_OPEN, QSF_DET_E_PARAM_POINTER);
+  }
+  else
+  {
+    QSF_ENTER_CRITICAL_SECTION;
+    for (i = 0u; (i < u_QsfPartitionCount) && (ap_QsfPartitions[i] != p_Part); i++)
+    {
+      // search handle
+    }
+    if ((i < u_QsfPartitionCount) &&
+        ((p_Part == p_QsfActivePartition) || (p_Part->u_Job != QSF_IDLE) || (p_Part->u_JobResult == MEMIF_JOB_PENDING)))
+    {
+      // re-open of a handle with a queued or running job, the job would continue with the new configuration
+      u_Err = QSF_DET_E_BUSY;
+    }
+    else if (i == QSF_PARTITION_MAX)
+    {
+      // no handle left
+      u_Err = QSF_DET_E_PARAM_HANDLE;
+    }
+    else
+    {
+      p_Part->p_Cfg = p_Cfg;
+      p_Part->u_Job = QSF_IDLE;
+      p_Part->u_JobResult = MEMIF_JOB_OK;
+      ap_QsfPartitions[i] = p_Part;
+      if (i == u_QsfPartitionCount)
+      {
+        u_QsfPartitionCount++;
+      }
+      u_RetVal = E_OK;
+    }
+    QSF_EXIT_CRITICAL_SECTION;
+    if (u_Err != QSF_DET_E_NONE)
+    {
+      QSF_DET_REPORT_ERROR(QSF_DET_API_PART_OPEN, u_Err);
+    }
+  }
+
+  return u_RetVal;
+}
+
+Std_ReturnType Fls_u_PartRead(tFlsPartition* p_Part, Fls_AddressType SourceAddress, uint8* TargetAddressPtr, Fls_LengthType Length)
+{
+  Std_ReturnType u_RetVal = E_NOT_OK;
+
+  if (b_QsfPartIsOpen(p_Part, QSF_DET_API_PART_READ) == TRUE)
+  {
+    u_RetVal = u_QsfPartQueue(p_Part, QSF_DET_API_PART_READ, QSF_READ, SourceAddress, TargetAddressPtr, Length);
+  }
+  return u_RetVal;
+}
+
+#if (QSF_WRITE_API == STD_ON)
+Std_ReturnType Fls_u_PartWrite(tFlsPartition* p_Part, Fls_AddressType TargetAddress, const uint8* SourceAddressPtr, Fls_LengthType Length)
+{
+  Std_ReturnType u_RetVal = E_NOT_OK;
+
+  if ((b_QsfPartIsOpen(p_Part, QSF_DET_API_PART_WRITE) == TRUE) && (b_QsfPartInWindow(p_Part, TargetAddress, Length) == TRUE))
+  {
+    // PRQA S 0311 3 // 2017-10-25; uidv7790
+    // summary: Msg(3:0311) Dangerous pointer cast results in loss of const qualification.
+    // reason: We use p_CurrentRam in both cases (read and write access). Cast is needed in the second case here.
+    u_RetVal = u_QsfPartQueue(p_Part, QSF_DET_API_PART_WRITE, QSF_WRITE, TargetAddress, (uint8*)SourceAddressPtr, Length);
+  }
+  return u_RetVal;
+}
+
+Std_ReturnType Fls_u_PartErase(tFlsPartition* p_Part, Fls_AddressType TargetAddress, Fls_LengthType Length)
+{
+  Std_ReturnType u_RetVal = E_NOT_OK;
+
+  if ((b_QsfPartIsOpen(p_Part, QSF_DET_API_PART_ERASE) == TRUE) && (b_QsfPartInWindow(p_Part, TargetAddress, Length) == TRUE))
+  {
+    u_RetVal = u_QsfPartQueue(p_Part, QSF_DET_API_PART_ERASE, QSF_ERASE, TargetAddress, NULL, Length);
+  }
+  return u_RetVal;
+}
+
+Std_ReturnType Fls_u_PartCompare(tFlsPartition* p_Part, Fls_AddressType SourceAddress, const uint8* TargetAddressPtr, Fls_LengthType Length)
+{
+  Std_ReturnType u_RetVal = E_NOT_OK;
+
+  if (b_QsfPartIsOpen(p_Part, QSF_DET_API_PART_COMPARE) == TRUE)
+  {
+    // PRQA S 0311 3 // 2017-10-25; uidv7790
+    // summary: Msg(3:0311) Dangerous pointer cast results in loss of const qualification.
+    // reason: We use p_CurrentRam in both cases (read and write access). Cast is needed in the second case here.
+    u_RetVal = u_QsfPartQueue(p_Part, QSF_DET_API_PART_COMPARE, QSF_COMPARE, SourceAddress, (uint8*)TargetAddressPtr, Length);
+  }
+  return u_RetVal;
+}
+
+Std_ReturnType Fls_u_PartBlankCheck(tFlsPartition* p_Part, Fls_AddressType TargetAddress, Fls_LengthType Length)
+{
+  Std_ReturnType u_RetVal = E_NOT_OK;
+
+  if (b_QsfPartIsOpen(p_Part, QSF_DET_API_PART_BLANKCHECK) == TRUE)
+  {
+    u_RetVal = u_QsfPartQueue(p_Part, QSF_DET_API_PART_BLANKCHECK, QSF_BLANKCHECK, TargetAddress, NULL, Length);
+  }
+  return u_RetVal;
+}
+#endif
+
+Std_ReturnType Fls_u_PartCancel(tFlsPartition* p_Part)
+{
+  Std_ReturnType u_RetVal = E_NOT_OK;
+
+  if ((b_QsfPartIsOpen(p_Part, QSF_DET_API_PART_CANCEL) == TRUE) && (u_Qsf_GetLock() == E_OK))
+  {
+    if (p_Part == p_QsfActivePartition)
+    {
+      v_QsfCancelJob();
+      // hands over a stopped job right away, an aborted write/erase after the re-initialization of the SDF
+      v_QsfSchedulePartitions();
+    }
+    else if (p_Part->u_Job != QSF_IDLE)
+    {
+      // queued job not started yet
+      p_Part->u_Job = QSF_IDLE;
+      p_Part->u_JobResult = MEMIF_JOB_CANCELED;
+    }
+    else
+    {
+      // no job, the result of the last job is kept
+    }
+    v_Qsf_Unlock();
+    u_RetVal = E_OK;
+  }
+  return u_RetVal;
+}
+
+MemIf_JobResultType Fls_u_PartGetJobResult(const tFlsPartition* p_Part)
+{
+  MemIf_JobResultType u_Result = MEMIF_JOB_FAILED;
+
+  if (p_Part == NULL)
+  {
+    QSF_DET_REPORT_ERROR(QSF_DET_API_PART_GET_JOB_RESULT, QSF_DET_E_PARAM_POINTER);
+  }
+  else
+  {
+    u_Result = p_Part->u_JobResult;
+  }
+  return u_Result;
 }
 
 // 2021-03-10; uie23485
 // Summary: Message(3:7002) Amount of non cyclic paths very high
 // Reason:  This is necessary for the main function
 // PRQA S 7002 ++
-// performing the actions
+// performing one step of the actions
 // uig00753 21.11.2023
 // msg(3:7004) HIS metrics check: cyclomatic complexitiy.
 // msg(3:7012) Info: number of executable lines per function.
 // Reason : cannot modify the code
 // PRQA S 7004,7012 1
-void Fls_MainFunction(void)
+static boolean b_QsfMainStep(void)
 {
   uint32 u_Step;
   uint32 u_dtus, u_maxdtus;
-  Std_ReturnType u_lock = u_Qsf_GetLock();
+  tQsfJob u_Job;
   e_Qsf_ErrorCodes RetVal;
   e_Qsf_ErrorCodes RetVal1;
   uint32 current_addr;
@@ -659,15 +1360,17 @@ void Fls_MainFunction(void)
   MemIf_ModeType Mode;
   uint8* CurrentRam = sQsf.p_CurrentRam;
   const Fls_ConfigType* QsfCfg = sQsf.p_QsfCfg;
-
-  if (E_OK != u_lock)
-  {
-    return;
-  }
+  boolean b_Prefetch = FALSE;
 
   switch(sQsf.u_Job)
   {
     case QSF_IDLE:
+#if (QSF_READ_AHEAD == STD_ON)
+      if ((sQsf.u_QsfStatus == MEMIF_IDLE) && (b_QsfReadStream == TRUE))
+      {
+        b_Prefetch = b_QsfReadAheadStep();
+      }
+#endif
       break;
 #if (QSF_WRITE_API == STD_ON)
     case QSF_ERASE:
@@ -813,6 +1516,10 @@ void Fls_MainFunction(void)
             v_QsfJobEnd();
           }
         }
+        else if (b_QsfNextVector() == TRUE) // next region of a scatter-gather job
+        {
+          sQsf.u_QsfStatus = MEMIF_BUSY;
+        }
         else // finished
         {
           v_QsfJobEnd();
@@ -855,13 +1562,10 @@ void Fls_MainFunction(void)
         // PRQA S 0404 11
         if (current_addr < end_addr)
         {
-          u_Step = sQsf.p_QsfCfg->ua_ReadAtOnce[sQsf.Qsf_Mode];
+          // the OTP area is small, the PAL transfers the whole range with one secured OTP mode entry
           current_addr = sQsf.u_CurrentAddr;
           end_addr = sQsf.u_EndAddr;
-          if (end_addr - current_addr < u_Step)
-          {
-            u_Step = sQsf.u_EndAddr - sQsf.u_CurrentAddr;
-          }
+          u_Step = end_addr - current_addr;
           // PRQA S 4342 3 // 2022-12-22; uif08910
           // summary: Msg(3:4342) An expression of 'essentially unsigned' type (unsigned char) is being cast to enum type 'e_Qsf_ErrorCodes'.
           // reason: Msg(3:4342) Enum is used to ensure debug comfort.
@@ -930,10 +1634,14 @@ void Fls_MainFunction(void)
             u_Step = sQsf.u_EndAddr - sQsf.u_CurrentAddr;
           }
           CurrentRam = sQsf.p_CurrentRam;
+#if (QSF_READ_AHEAD == STD_ON)
+          sQsf.u_RetVal = u_QsfReadChunk(current_addr, CurrentRam, &u_Step);
+#else
           // PRQA S 4342 3 // 2017-10-25; uidv7790
           // summary: Msg(3:4342) An expression of 'essentially unsigned' type (unsigned char) is being cast to enum type 'e_Qsf_ErrorCodes'.
           // reason: enum is used to ensure debug comfort
           sQsf.u_RetVal = (e_Qsf_ErrorCodes)PAL_u_QsfRead(current_addr , CurrentRam, u_Step);
+#endif
           sQsf.u_CurrentAddr += u_Step;
           // PRQA S 0491 3 // 2017-10-24; uidv7790
           // summary: Msg(3:0491) Array subscripting applied to an object of pointer type.
@@ -946,6 +1654,10 @@ void Fls_MainFunction(void)
             v_QsfJobEnd();
           }
         }
+        else if (b_QsfNextVector() == TRUE) // next region of a scatter-gather job
+        {
+          sQsf.u_QsfStatus = MEMIF_BUSY;
+        }
         else // finished
         {
           v_QsfJobEnd();
@@ -976,13 +1688,10 @@ void Fls_MainFunction(void)
       // PRQA S 0404 13
         if (current_addr < end_addr)
         {
-          u_Step = sQsf.p_QsfCfg->ua_ReadAtOnce[sQsf.Qsf_Mode];
+          // the OTP area is small, the PAL transfers the whole range with one secured OTP mode entry
           current_addr = sQsf.u_CurrentAddr;
           end_addr = sQsf.u_EndAddr;
-          if (end_addr - current_addr < u_Step)
-          {
-            u_Step = sQsf.u_EndAddr - sQsf.u_CurrentAddr;
-          }
+          u_Step = end_addr - current_addr;
           // PRQA S 4342 3 // 2022-09-06; uif08910
           // summary: Msg(3:4342) An expression of 'essentially unsigned' type (unsigned char) is being cast to enum type 'e_Qsf_ErrorCodes'.
           // reason: enum is used to ensure debug comfort
@@ -1119,19 +1828,108 @@ void Fls_MainFunction(void)
       }
       break;
 #endif
+    case QSF_CANCEL:
+      u_dtus = SYS_TimeGetSince(sQsf.u_StartTime);
+      if (u_dtus < QSF_CANCEL_READY_US)
+      {
+        // the SDF is in reset after 66h/99h, a status read before tREADY is not valid, checked again with the next call
+      }
+      else
+      {
+        // PRQA S 4342 3 // 2017-10-25; uidv7790
+        // summary: Msg(3:4342) An expression of 'essentially unsigned' type (unsigned char) is being cast to enum type 'e_Qsf_ErrorCodes'.
+        // reason: enum is used to ensure debug comfort
+        RetVal = (e_Qsf_ErrorCodes)PAL_u_QsfIsBusy();
+        if (RetVal != PAL_QSF_BUSY)
+        {
+          // re-initialization with the next call, it takes the reset and probe delays of a cold PAL_u_QsfInit
+          sQsf.u_Job = QSF_CANCEL_INIT;
+        }
+        else if (u_dtus > QSF_CANCEL_TIMEOUT_US)
+        {
+          sQsf.u_RetVal = PAL_QSF_ERROR_TIMEOUT;
+          v_QsfJobEnd();
+        }
+        else
+        {
+          // do nothing, the SDF finishes the reset
+        }
+      }
+      break;
+    case QSF_CANCEL_INIT:
+      // the reset restored the power-on configuration of the SDF
+      // PRQA S 4342 3 // 2017-10-25; uidv7790
+      // summary: Msg(3:4342) An expression of 'essentially unsigned' type (unsigned char) is being cast to enum type 'e_Qsf_ErrorCodes'.
+      // reason: enum is used to ensure debug comfort
+      sQsf.u_RetVal = (e_Qsf_ErrorCodes)PAL_u_QsfInit(sQsf.p_QsfCfg);
+      RetVal = sQsf.u_RetVal;
+      sQsf.u_Job = QSF_IDLE;
+#if (QSF_READ_AHEAD == STD_ON)
+      v_QsfReadAheadInvalidate();
+#endif
+      if (RetVal == PAL_QSF_OK)
+      {
+        sQsf.u_QsfJobStatus = MEMIF_JOB_CANCELED;
+        sQsf.u_QsfStatus = MEMIF_IDLE;
+      }
+      else
+      {
+        sQsf.u_QsfJobStatus = MEMIF_JOB_FAILED;
+        sQsf.u_QsfStatus = MEMIF_UNINIT;
+      }
+      break;
     default:
       // internal error
       sQsf.u_QsfStatus = MEMIF_UNINIT;
       sQsf.u_QsfJobStatus = MEMIF_JOB_FAILED;
       break;
   }
-  v_Qsf_Unlock();
   // PRQA S 7004 3 // 2017-10-25; uidv7790
   // summary: Msg(3:7004) HIS metrics check: cyclomatic complexitiy.
   // reason: Each case of this large switch-case could go into separate function.
+  u_Job = sQsf.u_Job;
+  return (((sQsf.u_QsfStatus == MEMIF_BUSY) && (u_Job != QSF_ERASE) && (u_Job != QSF_ERASE_4K) && (u_Job != QSF_CANCEL) &&
+           (u_Job != QSF_CANCEL_INIT)) ||
+          (b_Prefetch == TRUE)) ? TRUE : FALSE;
 }
 // PRQA S 7002 --
 
+// performing the actions, continued within the time budget of the current mode
+void Fls_MainFunction(void)
+{
+  uint32 u_StartTime;
+  uint32 u_Budget_us;
+  boolean b_More;
+#if (QSF_READ_AHEAD == STD_ON)
+  tQsfJob u_Job;
+#endif
+  Std_ReturnType u_lock = u_Qsf_GetLock();
+
+  if (E_OK != u_lock)
+  {
+    return;
+  }
+
+  u_StartTime = SYS_TimeGetCount();
+  u_Budget_us = au_QsfMainBudget_us[sQsf.Qsf_Mode];
+  v_QsfSchedulePartitions();
+#if (QSF_READ_AHEAD == STD_ON)
+  u_Job = sQsf.u_Job;
+  if ((u_Job == QSF_WRITE) || (u_Job == QSF_ERASE) || (u_Job == QSF_ERASE_4K) || (u_Job == QSF_OTP_WRITE))
+  {
+    v_QsfReadAheadInvalidate();
+  }
+#endif
+  do
+  {
+    b_More = b_QsfMainStep();
+  } while ((b_More == TRUE) && (SYS_TimeGetSince(u_StartTime) < u_Budget_us));
+  // hand over a finished partition job right away and start the next one
+  v_QsfSchedulePartitions();
+
+  v_Qsf_Unlock();
+}
+
 static Std_ReturnType u_Qsf_GetLock(void)
 {
   Std_ReturnType status;
@@ -1205,6 +2003,10 @@ Std_ReturnType Fls_v_EmergencyUnlock(void)
   // Prepare QSF for next job
   sQsf.u_Job = QSF_IDLE;
   sQsf.u_QsfStatus = MEMIF_IDLE;
+#if (QSF_READ_AHEAD == STD_ON)
+  // the interrupted job may have left the flash content undefined
+  v_QsfReadAheadInvalidate();
+#endif
 
   return u_Status;
 }
@@ -0,0 +1,119 @@
+// PRQA S 1011 EOF // 2017-10-25; uidv7790
+// summary: Msg(3:1011) [C99] Use of '//' comment.
+// reason: According coding template the comment style // shall be used.
+// COMPANY:   Continental Automotive
+// COMPONENT: QSF
+/// @file  Fls_Partition.h
+/// @brief Partition handles of the FLS module. Each handle carries its own configuration (write window,
+///        NvM offset, chunk sizes) and job, Fls_MainFunction schedules the queued jobs of all handles
+///        one after the other on the single SDF.
+
+
+#ifndef FLS_PARTITION_H
+#define FLS_PARTITION_H
+
+#include <Std_Types.h>
+#include <pal_qsf.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifndef QSF_PARTITION_MAX
+/// maximum number of partition handles served by Fls_MainFunction
+#define QSF_PARTITION_MAX 4u
+#endif
+
+/// API ids reported with QSF_DET_REPORT_ERROR()
+#define QSF_DET_API_INIT                  0x00u ///< Fls_Init(), same id as the AUTOSAR service
+#define QSF_DET_API_PART_OPEN             0x20u ///< Fls_u_PartOpen()
+#define QSF_DET_API_PART_READ             0x21u ///< Fls_u_PartRead()
+#define QSF_DET_API_PART_WRITE            0x22u ///< Fls_u_PartWrite()
+#define QSF_DET_API_PART_ERASE            0x23u ///< Fls_u_PartErase()
+#define QSF_DET_API_PART_COMPARE          0x24u ///< Fls_u_PartCompare()
+#define QSF_DET_API_PART_BLANKCHECK       0x25u ///< Fls_u_PartBlankCheck()
+#define QSF_DET_API_PART_GET_JOB_RESULT   0x26u ///< Fls_u_PartGetJobResult()
+#define QSF_DET_API_PART_CANCEL           0x27u ///< Fls_u_PartCancel()
+
+/// development errors reported with QSF_DET_REPORT_ERROR()
+#define QSF_DET_E_NONE                    0x00u ///< no error
+#define QSF_DET_E_BUSY                    0x06u ///< a job of the handle or a partition job is queued or running (FLS_E_BUSY)
+#define QSF_DET_E_PARAM_POINTER           0x0Au ///< a pointer parameter is NULL (FLS_E_PARAM_POINTER)
+#define QSF_DET_E_PARAM_HANDLE            0x20u ///< the handle is not registered or no handle is left
+
+/// handle of one partition client
+typedef struct
+{
+  const Fls_ConfigType* p_Cfg;              ///< configuration of the partition
+  volatile tQsfJob u_Job;                   ///< queued or running job, QSF_IDLE if none
+  volatile MemIf_JobResultType u_JobResult; ///< result of the current or last job
+  uint32 u_Addr;                            ///< partition relative address of the job
+  uint8* p_Ram;                             ///< RAM buffer of the job
+  uint32 u_Len;                             ///< length of the job in bytes
+} tFlsPartition;
+
+/// Registers a partition handle.
+///
+/// @pre                 Fls_Init() was called once.
+/// @post                Jobs can be queued for the handle.
+/// @param[out] p_Part   handle to be registered, has to stay valid while the FLS module is used
+/// @param[in]  p_Cfg    configuration of the partition
+/// @return              E_OK if the handle is registered, E_NOT_OK if no handle is left, a parameter is NULL or
+///                      the handle is registered and has a job queued or running
+Std_ReturnType Fls_u_PartOpen(tFlsPartition* p_Part, const Fls_ConfigType* p_Cfg);
+
+/// Queues a read job for a partition.
+///
+/// @pre                 Fls_u_PartOpen() was called for the handle.
+/// @post                Job result of the handle is MEMIF_JOB_PENDING until Fls_MainFunction has finished the job.
+/// @param[in] p_Part    partition handle
+/// @param[in] SourceAddress  partition relative flash address
+/// @param[out] TargetAddressPtr  RAM buffer
+/// @param[in] Length    number of bytes
+/// @return              E_OK if the job is queued, E_NOT_OK if the handle is NULL, not registered or has a job pending
+Std_ReturnType Fls_u_PartRead(tFlsPartition* p_Part, Fls_AddressType SourceAddress, uint8* TargetAddressPtr, Fls_LengthType Length);
+
+#if (QSF_WRITE_API == STD_ON)
+/// Queues a write job for a partition, see Fls_u_PartRead().
+/// @return              E_OK if the job is queued, E_NOT_OK if the handle is not registered or has a job pending or the range is outside the write window
+Std_ReturnType Fls_u_PartWrite(tFlsPartition* p_Part, Fls_AddressType TargetAddress, const uint8* SourceAddressPtr, Fls_LengthType Length);
+
+/// Queues a sector erase job for a partition, see Fls_u_PartRead(). \n
+/// The sector alignment is checked with the sector size of the partition when the job is started.
+/// @return              E_OK if the job is queued, E_NOT_OK if the handle is not registered or has a job pending or the range is outside the write window
+Std_ReturnType Fls_u_PartErase(tFlsPartition* p_Part, Fls_AddressType TargetAddress, Fls_LengthType Length);
+
+/// Queues a compare job for a partition, see Fls_u_PartRead().
+/// @return              E_OK if the job is queued, E_NOT_OK if the handle is not registered or has a job pending
+Std_ReturnType Fls_u_PartCompare(tFlsPartition* p_Part, Fls_AddressType SourceAddress, const uint8* TargetAddressPtr, Fls_LengthType Length);
+
+/// Queues a blank check job for a partition, see Fls_u_PartRead().
+/// @return              E_OK if the job is queued, E_NOT_OK if the handle is not registered or has a job pending
+Std_ReturnType Fls_u_PartBlankCheck(tFlsPartition* p_Part, Fls_AddressType TargetAddress, Fls_LengthType Length);
+#endif
+
+/// Cancels the queued or running job of a partition.
+///
+/// @pre                 Fls_u_PartOpen() was called for the handle.
+/// @post                A queued job is removed and a running read, compare or blank check is stopped, the job result
+///                      is MEMIF_JOB_CANCELED. A running write/erase is aborted with a software reset of the SDF, the
+///                      job result stays MEMIF_JOB_PENDING until Fls_MainFunction has re-initialized the SDF and the
+///                      content of the range is undefined.
+/// @param[in] p_Part    partition handle
+/// @return              E_OK if the job is canceled or no job is pending, E_NOT_OK if the handle is NULL or not
+///                      registered or Fls_MainFunction is running in another context
+Std_ReturnType Fls_u_PartCancel(tFlsPartition* p_Part);
+
+/// Returns the result of the current or last job of a partition.
+///
+/// @param[in] p_Part    partition handle
+/// @return              MEMIF_JOB_PENDING while the job is queued or running, MEMIF_JOB_FAILED if the handle is NULL,
+///                      the job result otherwise
+MemIf_JobResultType Fls_u_PartGetJobResult(const tFlsPartition* p_Part);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // #ifndef FLS_PARTITION_H
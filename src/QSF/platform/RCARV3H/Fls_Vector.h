@@ -0,0 +1,50 @@
+// PRQA S 1011 EOF // 2017-10-25; uidv7790
+// summary: Msg(3:1011) [C99] Use of '//' comment.
+// reason: According coding template the comment style // shall be used.
+// COMPANY:   Continental Automotive
+// COMPONENT: QSF
+/// @file  Fls_Vector.h
+/// @brief Scatter-gather jobs of the FLS module. A list of disjoint flash regions is read or written
+///        as one job, Fls_MainFunction continues with the next region without returning to the caller.
+
+
+#ifndef FLS_VECTOR_H
+#define FLS_VECTOR_H
+
+#include <Std_Types.h>
+#include <Fls.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// one region of a scatter-gather job
+typedef struct
+{
+  Fls_AddressType u_Addr;  ///< flash address, relative to the NvM offset like for Fls_Read()
+  uint8* p_Ram;            ///< RAM buffer, only read for Fls_WriteV()
+  Fls_LengthType u_Len;    ///< length of the region in bytes
+} tFlsVector;
+
+/// Reads several flash regions as one job.
+///
+/// @pre                 Fls_Init() was called.
+/// @post                Job result is MEMIF_JOB_PENDING until Fls_MainFunction has read all regions.
+/// @param[in] p_Vec     list of regions, has to stay valid until the job is finished
+/// @param[in] u_Count   number of regions
+/// @return              E_OK if the job is accepted, E_NOT_OK if the module is busy or the list is empty
+Std_ReturnType Fls_ReadV(const tFlsVector* p_Vec, uint32 u_Count);
+
+#if (QSF_WRITE_API == STD_ON)
+/// Writes several flash regions as one job, see Fls_ReadV().
+/// @return              E_OK if the job is accepted, E_NOT_OK if the module is busy, the list is empty
+///                      or a region is outside the write window
+Std_ReturnType Fls_WriteV(const tFlsVector* p_Vec, uint32 u_Count);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // #ifndef FLS_VECTOR_H
@@ -102,6 +102,62 @@ uint32 PAL_QSF_WINDOW_START;
 /// RPC buffer size (HW specific)
 #define RPC_WRBUF_SIZE  (256u)
 
+#ifndef PAL_QSF_READ_BURST_LEN
+/// read burst length in external address space mode in units of 64 bit, 1..32 (RPC_DRCR.RBURST + 1)
+#define PAL_QSF_READ_BURST_LEN 32u
+#endif
+/// bytes of one RPC read burst in the external address space
+#define PAL_QSF_READ_BURST_BYTES ((uint32)PAL_QSF_READ_BURST_LEN * 8u)
+#ifndef PAL_QSF_READ_CACHE_FLUSH
+/// flush the RPC read cache at each read start (STD_ON) or only after a program/erase command (STD_OFF)
+#define PAL_QSF_READ_CACHE_FLUSH STD_ON
+#endif
+/// RPC_DRCR value for external address space reads: SSLN = 1, RBURST, RCF, RBE and SSLE
+#define PAL_QSF_DRCR(rcf, rbe, ssle) ( 0x01000000u | (((uint32)PAL_QSF_READ_BURST_LEN - 1u) << 16u) | \
+                                       ((uint32)(rcf) << 9u) | ((uint32)(rbe) << 8u) | (uint32)(ssle) )
+
+#ifndef PAL_QSF_BURST_COPY
+/// copy from the external address space with 32 byte block transfers (STD_ON) or with Qsf_memcpy (STD_OFF)
+#define PAL_QSF_BURST_COPY STD_ON
+#endif
+#if (PAL_QSF_BURST_COPY == STD_ON) && ((PAL_QSF_READ_BURST_LEN % 4u) != 0u)
+#error "PAL_QSF_BURST_COPY copies whole 32 byte blocks per read burst, PAL_QSF_READ_BURST_LEN must be a multiple of 4"
+#endif
+
+#ifndef PAL_QSF_DUAL_FLASH
+/// two SDF devices of the same type on the RPC-IF are accessed in parallel (STD_ON): even bytes are
+/// stored in the first device, odd bytes in the second one; single SDF device (STD_OFF). \n
+/// Only reads gain bandwidth: one program command is limited by the RPC write buffer (RPC_WRBUF_SIZE),
+/// which is shared by both channels, so each device gets 128 bytes per command and the write
+/// throughput stays at the level of a single device.
+#define PAL_QSF_DUAL_FLASH STD_OFF
+#endif
+#if (PAL_QSF_DUAL_FLASH == STD_ON)
+/// number of SDF devices accessed in parallel
+#define PAL_QSF_DEVICE_CNT 2u
+/// RPC_CMNCR.BSZ[1:0] = 2'b01: Serial Flash (2ch)
+#define PAL_QSF_CMNCR_BSZ  0x00000001u
+#else
+/// number of SDF devices accessed in parallel
+#define PAL_QSF_DEVICE_CNT 1u
+/// RPC_CMNCR.BSZ[1:0] = 2'b00: Serial Flash (1ch)
+#define PAL_QSF_CMNCR_BSZ  0x00000000u
+#endif
+#ifndef PAL_QSF_CONTINUOUS_READ
+/// keep Macronix and Micron devices in continuous read mode between quad I/O reads in external address
+/// space mode, so the read command is sent only once (STD_ON); send the command with every read (STD_OFF)
+#define PAL_QSF_CONTINUOUS_READ STD_OFF
+#endif
+/// Macronix mode bits P[7:4] != P[3:0]: stay in performance enhance mode
+#define PAL_QSF_MODE_BITS_MACRONIX 0xA5u
+/// Micron mode bits with XIP confirmation bit = 0: stay in XIP mode
+#define PAL_QSF_MODE_BITS_MICRON   0x00u
+
+/// RPC_CMNCR value with the bus size of the configured number of devices
+#define PAL_QSF_CMNCR(val) ( (uint32)(val) | PAL_QSF_CMNCR_BSZ )
+/// address inside each device for a flash address, manual mode commands are not translated by the RPC
+#define PAL_QSF_DEV_ADDR(addr) ( (uint32)(addr) / PAL_QSF_DEVICE_CNT )
+
 /// R7 cache line length
 #define CACHE_LINE_LEN (32u)
 /// mask of R7 cache line size
@@ -166,6 +222,26 @@ static uint32 u_lastCalibrationTime_ticks ;
 /// DDR calibration interval: 10 million ticks = 1 second
 #define CALIBRATION_INTERVAL_TICKS 10000000u
 
+/// time in us the RPC module reset is asserted: 1 RCLK (assuming frequency is 32.55kHz)
+#define PAL_QSF_RESET_ASSERT_US 31u
+/// time in us to wait after the RPC module reset is released: tREADY1(35us) - tRHSL(10us) = 25us
+#define PAL_QSF_RESET_READY_US 25u
+
+#ifndef PAL_QSF_WARM_INIT
+/// Skip RPC reset, device probing and calibration in PAL_u_QsfInit when the device was already
+/// initialized with the same clock (STD_ON), or always perform the full initialization (STD_OFF)
+#define PAL_QSF_WARM_INIT STD_ON
+#endif
+
+/// SPCLK frequency of the last successful full initialization, PAL_QSF_SPCLK_ZERO if not initialized
+static uint32 u_ProbedSpClkFreq;
+/// flash content may have changed since the last flush of the RPC read cache
+static boolean b_ReadCacheDirty = TRUE;
+/// device is in continuous read mode and expects the address without command
+static boolean b_ContinuousRead = FALSE;
+/// bits of the last manual mode read that differ between the parallel devices
+static uint32 u_DualDiff = 0u;
+
 /// mask to compare with configured page size
 #define PAGEMASK    ( sPAL_Qsf.PageSize   - 1u )
 /// mask to compare with configured sector size
@@ -500,6 +576,16 @@ static Std_ReturnType u_Qsf_ReadID(uint8 *ManufacturerID, uint16 *DeviceID);
 
 static Std_ReturnType u_Qsf_SetParameters(uint32 PageSizeBytes, uint32 SectorSizeBytes, uint32 DeviceSizeBytes, uint32 TimeOut_WriteWord_us, uint32 TimeOut_EraseSector_ms);
 
+/// Reference Source file : pal_qsf.c
+///
+/// @pre None
+/// @post Sector size fits to the configured write window
+/// @param  ConfigPtr configuration of the partition
+/// @return status of u_Qsf_SetParameters
+/// @globals sPAL_Qsf
+/// @InOutCorrelation 4 KiB sectors for write windows up to 64 KiB, 64 KiB sectors otherwise
+static Std_ReturnType u_Qsf_SetPartitionParameters(const Fls_ConfigType* ConfigPtr);
+
 /// Reference Source file : pal_qsf.c
 ///
 /// @pre None
@@ -636,6 +722,39 @@ static Std_ReturnType u_Qsf_WriteCommandData(uint8 cmd, uint32 data, uint32 size
 
 static Std_ReturnType u_Qsf_ReadCommandData(uint32 *read, uint8 cmd, uint32 size, uint32 addr);
 
+/// Reference Source file : pal_qsf.c
+///
+/// @pre None
+/// @post None
+/// @param cmd command byte
+/// @return PAL_QSF_OK, PAL_QSF_ERROR_TIMEOUT if the transfer did not end
+/// @globals None
+/// @InOutCorrelation The command is sent in manual mode without address and data. Unlike
+///                   u_Qsf_WriteCommandData() the WIP bit is not polled afterwards.
+static Std_ReturnType u_Qsf_SendCommand(uint8 cmd);
+
+/// Reference Source file : pal_qsf.c
+///
+/// @pre None
+/// @post RPC is in manual mode with command and address of the OTP transfer set
+/// @param cmd OTP read or program command
+/// @param addr address inside the OTP area
+/// @return static void
+/// @globals None
+/// @InOutCorrelation Sets up the manual mode registers shared by the OTP read and program transfers.
+static void v_Qsf_SetOtpManualMode(uint8 cmd, uint32 addr);
+
+/// Reference Source file : pal_qsf.c
+///
+/// @pre None
+/// @post None
+/// @param left number of bytes left for the command
+/// @param p_Spide SPIDE bits of SMENR for the returned number of bytes
+/// @return number of bytes of the next manual mode transfer (4, 2 or 1)
+/// @globals None
+/// @InOutCorrelation Splits an OTP transfer into 32-bit data phases, the rest is sent as 16-bit and 8-bit data.
+static uint32 u_Qsf_OtpChunk(uint32 left, uint32 *p_Spide);
+
 /// Reference Source file : pal_qsf.c
 ///
 /// @pre None
@@ -712,6 +831,44 @@ static void PAL_v_QsfDDRCalibration(void);
 /// @traceability
 
 static void v_Qsf_DCacheRegionInvalidate(const uint32 u_Start, const uint32 u_Len);
+
+/// Reference Source file : pal_qsf.c
+///
+/// @pre u_Qsf_StartRead() was called for the range
+/// @post data of the external address space is copied to RAM
+/// @param  RAMptr destination in RAM
+/// @param  WindowAddr source address in the external address space
+/// @param  SizeBytes number of bytes
+/// @globals none
+/// @InOutCorrelation The source is aligned to the RPC read burst (PAL_QSF_READ_BURST_BYTES). Each burst
+///                   is then copied as a whole in blocks of 8 words (LDM/STM bursts), so it is fetched
+///                   once and consumed by few bus accesses.
+static void v_Qsf_WindowCopy(uint8 *RAMptr, uint32 WindowAddr, uint32 SizeBytes);
+
+/// Reference Source file : pal_qsf.c
+///
+/// @pre None
+/// @post Device accepts commands, b_ContinuousRead is FALSE
+/// @param None
+/// @return static void
+/// @globals b_ContinuousRead
+/// @InOutCorrelation If the device is in continuous read mode, a mode bit reset (address and option data
+///                   phase with all data lines high) is sent in manual mode. A failed transfer is reported
+///                   by the following manual mode command.
+static void v_Qsf_ExitContinuousRead(void);
+
+#if (PAL_QSF_CONTINUOUS_READ == STD_ON)
+/// Reference Source file : pal_qsf.c
+///
+/// @pre u_Qsf_StartRead() has configured a quad I/O read mode
+/// @post Next read of the external address space keeps the device in continuous read mode
+/// @param Mode configured read mode
+/// @return static void
+/// @globals b_ContinuousRead, sPAL_Qsf
+/// @InOutCorrelation The mode bits are sent as option data in the first dummy cycles. The command phase
+///                   is disabled while the device is already in continuous read mode.
+static void v_Qsf_SetContinuousRead(e_PAL_QspiMode Mode);
+#endif
 #ifdef QSF_PRESBL_USE_CACHE
 static void v_Qsf_SyncMemories(void);
 #endif
@@ -728,7 +885,8 @@ Std_ReturnType PAL_u_QsfLockOTPArray(void)
 {
   Std_ReturnType status;
   uint8          data = 0u;
-	e_PAL_SdfType type_res = sPAL_Qsf.Type;
+  // OTP areas are not striped, they are only supported with a single device
+	e_PAL_SdfType type_res = (PAL_QSF_DEVICE_CNT == 1u) ? sPAL_Qsf.Type : PAL_SDF_TYPE_UNKNOWN;
   if(type_res == PAL_SDF_TYPE_MACRONIX)
   {
     //Write enable
@@ -755,7 +913,8 @@ Std_ReturnType PAL_u_QsfLockOTPArray(void)
 }
 
 Std_ReturnType PAL_u_QsfReadOTPArray(uint8* read, uint32 size, uint32 addr)
-// Function: Reads data from OTP memory
+// Function: Reads data from OTP memory. The whole range is read with one command, SSL is kept asserted
+//           between the 32-bit data phases. Macronix enters and exits the secured OTP area only once.
 // Return values:
 // PAL_QSF_OK       operation complete
 // PAL_QSF_ERROR_TIMEOUT    operation timed out
@@ -763,9 +922,14 @@ Std_ReturnType PAL_u_QsfReadOTPArray(uint8* read, uint32 size, uint32 addr)
 {
   Std_ReturnType status;
   uint32         data32;
-  uint32         dummyCyclesEnabled;
-  uint8          cmd;
-	e_PAL_SdfType type_res = sPAL_Qsf.Type;
+  uint32         smenr;
+  uint32         spide = 0u;
+  uint32         cnt;
+  uint32         left = size;
+  uint8*         p_read = read;
+  uint8          cmd = 0u;
+  // OTP areas are not striped, they are only supported with a single device
+	e_PAL_SdfType type_res = (PAL_QSF_DEVICE_CNT == 1u) ? sPAL_Qsf.Type : PAL_SDF_TYPE_UNKNOWN;
   if(type_res == PAL_SDF_TYPE_MACRONIX)
   {
     //*Change from main memory array to secured OTP area.
@@ -775,6 +939,7 @@ Std_ReturnType PAL_u_QsfReadOTPArray(uint8* read, uint32 size, uint32 addr)
   }else if(type_res == PAL_SDF_TYPE_MICRON)
   {
     uint8 DummyCycles_res = (uint8)(sPAL_Qsf.DummyCycles-1uL);
+    v_Qsf_ExitContinuousRead();
     cmd = 0x4Bu; //command: 0x4B - READ OTP ARRAY
   // PRQA S 0303 1 // 0303_SFR_32
     SFR32( RPC_SMDMCR ) = DummyCycles_res;
@@ -786,64 +951,44 @@ Std_ReturnType PAL_u_QsfReadOTPArray(uint8* read, uint32 size, uint32 addr)
 
   if(status == E_OK)
   {
-    // PRQA S 0303 7 //0303_SFR_32
-    SFR32( RPC_DRCR   ) = 0x01000000u;    // Data read control        negate SSL in case still in continuous read mode
-    SFR32( RPC_OFFSET1    ) = 0x31511144u;    // PHY timing offset        set PHY read mode to SDR
-    SFR32( RPC_PHYCNT ) = 0x80030260u;    // PHY control          PHYMEM[1:0] = 2'b00: Serial Flash SDR;  CAL = 1: PHY calibration
-    SFR32( RPC_CMNCR  ) = 0x81FFF300u;    // Common control       BSZ[1:0] = 2'b00: Serial Flash (1ch);  MD = 1: Manual mode
-    SFR32( RPC_SMCMR  ) = ((uint32) cmd) << 16u; // Manual mode command       CMD[7:0] = 8'h05 = RDSR1: Read status register 1
-    SFR32( RPC_SMDRENR    ) = 0x00000000u;    // Manual mode DDR enable   HYPE = 3'b000: SPI Flash;  SPIDRE = 0: data SDR transfer
-    SFR32( RPC_SMADR  ) = addr;
-    // PRQA S 4461 3 // 4461_UL_Warning
-    // PRQA S 0303 1 // 0303_SFR_32
-      e_PAL_SdfType type_res1 =  sPAL_Qsf.Type;
-    dummyCyclesEnabled = type_res1 == PAL_SDF_TYPE_MICRON ? (1UL << 15UL) : 0UL; //if Micron enable dummy cycles
-    switch (size)
-    {
-      case 1u:
-       // PRQA S 0303 1 //0303_SFR_32
-        SFR32( RPC_SMENR  ) = 0x00004708u | dummyCyclesEnabled;   // Manual mode enable       31:30 CDB  [1:0] = 2'b00: 1-bit command (MOSI/MISO)
-        break;
-      case 2u:
-    		// PRQA S 0303 1 //0303_SFR_32
-        SFR32( RPC_SMENR  ) = 0x0000470Cu | dummyCyclesEnabled;   // Manual mode enable       31:30 CDB  [1:0] = 2'b00: 1-bit command (MOSI/MISO)
-        break;
-      case 4u:
-      default:
-    		// PRQA S 0303 1 //0303_SFR_32
-        SFR32( RPC_SMENR  ) = 0x0000470Fu | dummyCyclesEnabled;   // Manual mode enable       31:30 CDB  [1:0] = 2'b00: 1-bit command (MOSI/MISO)
-        break;
-    }
+    v_Qsf_SetOtpManualMode(cmd, addr);
+    // PRQA S 4461 1 // 4461_UL_Warning
+    smenr = (type_res == PAL_SDF_TYPE_MICRON) ? 0x0000C700u : 0x00004700u;   // Manual mode enable of the first transfer
       //              17:16 SPIDB[1:0] = 2'b00: 1-bit data    (MOSI/MISO)
       //              15    DME        =    x : dummy cycle enabled (Macronix 0 / Micron 1)
       //              14    CDE        =    1 : Command enabled
       //              12    OCDE       =    0 : Option Command disabled
       //              11:8  ADE  [3:0] = 0111 : 24-bit address
       //              7:4   OPDE [3:0] = 0000 : option data disabled
-      //              3:0   SPIDE[3:0] = xxxx : (1000 8-bit, 1100 16-bit, 1111 32-bit)
-    		// PRQA S 0303 1 //0303_SFR_32
-    SFR32( RPC_SMCR   ) = 0x00000005u;    // Manual mode control      SPIRE = 1: Data read enable;  SPIWE = 0: Data write disabled;  SPIE = 1: SPI transfer start
-
-    status = u_Qsf_WaitTxEnd();
-  }
-
-  if ( status == (Std_ReturnType)PAL_QSF_OK)
-  {
-    		// PRQA S 0303 1 //0303_SFR_32
-    data32 = SFR32( RPC_SMRDR0 );
-    if(size > 0u)
+      //              3:0   SPIDE[3:0] = xxxx : set per transfer by u_Qsf_OtpChunk()
+    while((left > 0u) && (status == E_OK))
     {
-      // 2022-09-06; uif08910
-      // Summary: Message(3:1496) [I] Destination and source objects may have incompatible types.
-      //          Message(3:0314) Implicit conversion from a pointer to object type to a pointer to void.
-      //          Message(3:0326) cast b/w pointer to void type and an integral type
-      //          Message(3:4461) UL is being converted to narrower unsigned type, uint32 on assignment.
-      // Reason:  Internal driver design and memcpy constraint.
-      // PRQA S 0326,0314,1496,4461 1
-      (void)Qsf_memcpy((void*)read, (void*)&data32, size);
+      cnt = u_Qsf_OtpChunk(left, &spide);
+    		// PRQA S 0303 2 //0303_SFR_32
+      SFR32( RPC_SMENR  ) = smenr | spide;
+      SFR32( RPC_SMCR   ) = (cnt < left) ? 0x00000105u : 0x00000005u;    // Manual mode control      SSLKP = 1 until the last transfer;  SPIRE = 1: Data read enable;  SPIE = 1: SPI transfer start
+      status = u_Qsf_WaitTxEnd();
+      if ( status == (Std_ReturnType)PAL_QSF_OK)
+      {
+    		// PRQA S 0303 1 //0303_SFR_32
+        data32 = SFR32( RPC_SMRDR0 );
+        // 2022-09-06; uif08910
+        // Summary: Message(3:1496) [I] Destination and source objects may have incompatible types.
+        //          Message(3:0314) Implicit conversion from a pointer to object type to a pointer to void.
+        //          Message(3:0326) cast b/w pointer to void type and an integral type
+        //          Message(3:4461) UL is being converted to narrower unsigned type, uint32 on assignment.
+        // Reason:  Internal driver design and memcpy constraint.
+        // PRQA S 0326,0314,1496,4461 1
+        (void)Qsf_memcpy((void*)p_read, (void*)&data32, cnt);
+        // PRQA S 0491 1 // instead of pointer arithmetic
+        p_read = &p_read[cnt];
+        left -= cnt;
+      }
+      // command, address and dummy cycles were sent, the following transfers continue the data phase
+      smenr = 0u;
     }
   }
-  // e_PAL_SdfType type_res =  sPAL_Qsf.Type;
+
   if(type_res == PAL_SDF_TYPE_MACRONIX)
   {
     //Return from secured OTP area to main memory array.
@@ -862,17 +1007,26 @@ Std_ReturnType PAL_u_QsfReadOTPArray(uint8* read, uint32 size, uint32 addr)
 // PRQA S 7002 ++
 Std_ReturnType PAL_u_QsfWriteOTPArray(uint8* p_data, uint32 size, uint32 addr)
 // Function: programs OTP memory. Once bit in this memory is set to 0 it can't be written back to 1.
+//           Each OTP page is programmed with one page program command, SSL is kept asserted between the
+//           32-bit data phases. Macronix enters and exits the secured OTP area only once.
 // Return values:
 // PAL_QSF_OK       operation complete
 // PAL_QSF_ERROR_TIMEOUT    operation timed out
 // PAL_QSF_ERROR_NOTSUPPORTED  SW for this hardware is not available
 {
   Std_ReturnType status;
-  uint32 writeData;
-  uint32 data = 0u;
-  uint8  cmd;
-  uint8  cnt;
-      e_PAL_SdfType type_res =  sPAL_Qsf.Type;
+  uint32 data;
+  uint32 smenr;
+  uint32 spide = 0u;
+  uint32 pageLeft;
+  uint32 cnt;
+  uint32 i;
+  uint32 left = size;
+  uint32 otpAddr = addr;
+  uint8* p_write = p_data;
+  uint8  cmd = 0u;
+  // OTP areas are not striped, they are only supported with a single device
+      e_PAL_SdfType type_res = (PAL_QSF_DEVICE_CNT == 1u) ? sPAL_Qsf.Type : PAL_SDF_TYPE_UNKNOWN;
   if(type_res == PAL_SDF_TYPE_MACRONIX)
   {
     //*Change from main memory array to secured OTP area.
@@ -888,75 +1042,54 @@ Std_ReturnType PAL_u_QsfWriteOTPArray(uint8* p_data, uint32 size, uint32 addr)
     status = (Std_ReturnType)PAL_QSF_ERROR_NOTSUPPORTED;
   }
 
-
-  for(cnt = 0; (cnt < size) && (cnt < sizeof(uint32)); cnt++)
+  while((left > 0u) && (status == E_OK))
   {
-    ((uint8*)&data)[cnt] = p_data[cnt];
-  }
+    // a page program must not cross the page boundary
+    pageLeft = sPAL_Qsf.PageSize - (otpAddr & PAGEMASK);
+    if(pageLeft > left)
+    {
+      pageLeft = left;
+    }
+    otpAddr += pageLeft;
+    left -= pageLeft;
 
-  if( status == E_OK )
-  {
     status = u_Qsf_WriteEnable();
-    switch(size)
+    if( status == E_OK )
     {
-      case 1u:
-        writeData = ( (data & (uint32)0xFF) << 24u ); // shift by 24 required
-        break;
-      case 2u:
-        writeData = ( (data & (uint32)0xFFFF) << 16u );
-        break;
-      case 3u:
-        writeData = data | ((uint32)0xFFu << 24u);
-        break;
-      default:
-        writeData = data;
-        break;
+      v_Qsf_SetOtpManualMode(cmd, otpAddr - pageLeft);
+      smenr = 0x00004700u;    // Manual mode enable of the first transfer
+      //              17:16 SPIDB[1:0] = 2'b00: 1-bit data    (MOSI/MISO)
+      //              15    DME        =    0 : dummy cycle disabled
+      //              14    CDE        =    1 : Command enabled
+      //              12    OCDE       =    0 : Option Command disabled
+      //              11:8  ADE  [3:0] = 0111 : 24-bit address (0000 disabled, 0111 24-bit, 1111 32-bit)
+      //              7:4   OPDE [3:0] = 0000 : option data disabled
+      //              3:0   SPIDE[3:0] = xxxx : set per transfer by u_Qsf_OtpChunk()
     }
-    		// PRQA S 0303 8 //0303_SFR_32
-    SFR32( RPC_DRCR   ) = 0x00000000u;    // Data read control        negate SSL in case still in continuous read mode
-    SFR32( RPC_OFFSET1    ) = 0x31511144u;    // PHY timing offset        set PHY read mode to SDR
-    SFR32( RPC_PHYCNT ) = 0x80030260u;    // PHY control          PHYMEM[1:0] = 2'b00: Serial Flash SDR;  CAL = 1: PHY calibration
-    SFR32( RPC_CMNCR  ) = 0x81FFF300u;    // Common control       BSZ[1:0] = 2'b00: Serial Flash (1ch);  MD = 1: Manual mode
-    SFR32( RPC_SMCMR  ) = ((uint32) cmd) << 16u; // Manual mode command       CMD[7:0] = 8'h05 = RDSR1: Read status register 1
-    SFR32( RPC_SMDRENR    ) = 0x00000000u;    // Manual mode DDR enable   HYPE = 3'b000: SPI Flash;  SPIDRE = 0: data SDR transfer
-
-    SFR32( RPC_SMADR  ) = addr;
-    switch (size)
+    while((pageLeft > 0u) && (status == E_OK))
     {
-      case 1u:
-    		// PRQA S 0303 1 //0303_SFR_32
-        SFR32( RPC_SMENR  ) = 0x00004708u;    // Manual mode enable       31:30 CDB  [1:0] = 2'b00: 1-bit command (MOSI/MISO)
-        break;
-      case 2u:
-    		// PRQA S 0303 1 //0303_SFR_32
-        SFR32( RPC_SMENR  ) = 0x0000470Cu;    // Manual mode enable       31:30 CDB  [1:0] = 2'b00: 1-bit command (MOSI/MISO)
-        break;
-      case 4u:
-      default:
-    		// PRQA S 0303 1 //0303_SFR_32
-        SFR32( RPC_SMENR  ) = 0x0000470Fu;    // Manual mode enable       31:30 CDB  [1:0] = 2'b00: 1-bit command (MOSI/MISO)
-        break;
+      cnt = u_Qsf_OtpChunk(pageLeft, &spide);
+      data = 0u;
+      for(i = 0u; i < cnt; i++)
+      {
+        data |= ((uint32)p_write[i]) << (8u * i);
+      }
+    		// PRQA S 0303 3 //0303_SFR_32
+      SFR32( RPC_SMENR  ) = smenr | spide;
+      SFR32( RPC_SMWDR0 ) = data << (8u * (4u - cnt));   // 8 and 16-bit data is taken from the upper bytes
+      SFR32( RPC_SMCR   ) = (cnt < pageLeft) ? 0x00000103u : 0x00000003u;   // Manual mode control      SSLKP = 1 until the last transfer;  SPIWE = 1: Data write enabled;  SPIE = 1: SPI transfer start
+      status = u_Qsf_WaitTxEnd();
+      // PRQA S 0491 1 // instead of pointer arithmetic
+      p_write = &p_write[cnt];
+      pageLeft -= cnt;
+      // command and address were sent, the following transfers continue the data phase
+      smenr = 0u;
     }
-    //              17:16 SPIDB[1:0] = 2'b00: 1-bit data    (MOSI/MISO)
-    //              15    DME        =    0 : dummy cycle disabled
-    //              14    CDE        =    1 : Command enabled
-    //              12    OCDE       =    0 : Option Command disabled
-    //              11:8  ADE  [3:0] = 0111 : 24-bit address (0000 disabled, 0111 24-bit, 1111 32-bit)
-    //              7:4   OPDE [3:0] = 0000 : option data disabled
-    //              3:0   SPIDE[3:0] = xxxx : 8,16 or 32-bit data (1000 8-bit, 1100 16-bit, 1111 32-bit)
 
-    		// PRQA S 0303 2 //0303_SFR_32
-    SFR32( RPC_SMWDR0 ) = writeData;
-    SFR32( RPC_SMCR   ) = 0x00000003u;   // Manual mode control      SPIRE = 0: Data read disabled;  SPIWE = 1: Data write enabled;  SPIE = 1: SPI transfer start
-  }
-  if ( status == E_OK )
-  {
-    status = u_Qsf_WaitTxEnd();
-  }
-
-  if ( status == E_OK )
-  {
-    status = u_Qsf_WaitWIP(100u);
+    if ( status == E_OK )
+    {
+      status = u_Qsf_WaitWIP(PAL_QSF_SDF_MAX_tPP_US);
+    }
   }
 
   if(type_res == PAL_SDF_TYPE_MACRONIX)
@@ -986,7 +1119,6 @@ static Std_ReturnType u_Qsf_Init ( uint32 SPCLKfreq )
 // PAL_QSF_ERROR_TIMEOUT    could not enable module clock
 {
   uint32 u_RegVal = 0u;
-  volatile uint32 i;
   Std_ReturnType status = (Std_ReturnType)PAL_QSF_OK;
 
 #ifdef RCAR_V3H
@@ -1104,12 +1236,11 @@ static Std_ReturnType u_Qsf_Init ( uint32 SPCLKfreq )
       /*assert reset to the RPC module for the frequency change to take place.*/
     		// PRQA S 0303 6 //0303_SFR_32
       SFR32( CPG_SRCR9   ) |= (uint32) BIT(17uL); // assert reset
-// date: 2023-11-22, reviewer: uif85752, No unwanted effects discovered
-// Msg(3:3416) Logical operation performed on expression with possible side effects.
-// PRQA S 3416 3
-      for(i=0u;i<1000u;i++){};           // wait for 1 RCLK (assuming frequency is 32.55kHz)
+      pDSB();
+      SYS_TimeDelay(PAL_QSF_RESET_ASSERT_US);
       SFR32( CPG_SRSTCLR9 ) = BIT(17uL); // release reset
-      for(i=0u;i<1000u;i++){};           // wait: tREADY1(35us) - tRHSL(10us) = 25us
+      pDSB();
+      SYS_TimeDelay(PAL_QSF_RESET_READY_US);
     // PRQA S 0303 2 //0303_SFR_32
       SFR32( RPC_SSLDR  ) = 0x00000400u; // SSL delay            idle time: 1 CLK, SSL assert time: 5.5 CLKs, SPCLK activation after SSL: 1 CLK
       SFR32( RPC_DREAR  ) = 0x00000001u; // Data read extended address   use 64MiB window [25:0]
@@ -1168,118 +1299,197 @@ Std_ReturnType PAL_u_QsfInit(const Fls_ConfigType* ConfigPtr)
 
   uint8 id;
   uint16 device;
-
-  // initialize controller IP
-  Std_ReturnType status = u_Qsf_Init( SPCLKfreq );
-
-#if 0
-  if ( status == E_OK )
+#if (PAL_QSF_CONTINUOUS_READ == STD_ON)
+  uint32 vcr;
 #endif
+  Std_ReturnType status;
+
+#if (PAL_QSF_WARM_INIT == STD_ON)
+  if (u_ProbedSpClkFreq == SPCLKfreq)
   {
-    // 2021-03-11; uie23485
-    // Summary: Message(3:2982) This assignment is redundant. The value of this object is never used before being modified.
-    // Reason:  This must have been done for debug purposes?
-    // PRQA S 2982 ++
-    if(ConfigPtr->u_WriteWindowSize <= 0x10000uL)
+    // warm re-initialization: controller and device are set up and calibrated, only the partition changes
+    status = u_Qsf_SetPartitionParameters(ConfigPtr);
+    if ((status == E_OK) && (sPAL_Qsf.Type == PAL_SDF_TYPE_MACRONIX))
     {
-      // set default parameters for this library
-      status = u_Qsf_SetParameters( 256u, 4u*KiB, 64u*MiB, 5000u, 3000u );// for smaller partition
-    }
-    else
-    {
-      status = u_Qsf_SetParameters( 256u, 64u*KiB, 64u*MiB, 5000u, 3000u );// for bigger partition
+      // EXSO: the secured OTP area may have been entered since the cold init, return to the main array
+      status = u_Qsf_WriteCommandData(0xC1u,0x0,0x0,0x0);
     }
+  }
+  else
+#endif
+  {
+    // initialize controller IP
+    status = u_Qsf_Init( SPCLKfreq );
+    u_ProbedSpClkFreq = (uint32)PAL_QSF_SPCLK_ZERO;
+#if (PAL_QSF_CONTINUOUS_READ == STD_ON)
+    // a previous boot stage may have left the device in continuous read mode, reset it with the first command
+    b_ContinuousRead = TRUE;
+#endif
+
 #if 0
     if ( status == E_OK )
 #endif
     {
-
-      status = u_Qsf_ReadID(&id, &device);
+      // 2021-03-11; uie23485
+      // Summary: Message(3:2982) This assignment is redundant. The value of this object is never used before being modified.
+      // Reason:  This must have been done for debug purposes?
+      // PRQA S 2982 ++
+      status = u_Qsf_SetPartitionParameters(ConfigPtr);
+#if 0
       if ( status == E_OK )
+#endif
       {
-        switch (id)
-        {
-        case 0xC2u:  // device 25
-          sPAL_Qsf.Type=PAL_SDF_TYPE_MACRONIX;
-          break;
-        case 0x20u: // 3V3 device BA and BB
-          sPAL_Qsf.Type=PAL_SDF_TYPE_MICRON;
-          break;
-        case 0x01u: // 128Mb device 20 and 02
-          sPAL_Qsf.Type=PAL_SDF_TYPE_CYPRESS;
-          break;
-        default:
-          sPAL_Qsf.Type=PAL_SDF_TYPE_UNKNOWN;
-          break;
-        }
 
-        switch (sPAL_Qsf.Type)
+        status = u_Qsf_ReadID(&id, &device);
+        if ( status == E_OK )
         {
-        case PAL_SDF_TYPE_MACRONIX:  // id=0xC2 device 25
-          // Return from secured OTP area to main memory array.
-          // EXSO (C1h)
-          // This is necessary to ensure that SDF is returned to main memory region with each request
-          status = u_Qsf_WriteCommandData(0xC1u,0x0,0x0,0x0);
-
-          status = u_Qsf_WriteEnable();
-          status = u_Qsf_WriteCommandData ( 0x01u, (uint32)(0x87uL << 8u) | 0x40u, 16u, 0u );
-          // status=0x40 QE bit
-          // config[2..0]=b111 default output driver strength (24 Ohms)
-          // config[7..6]=b10  8 dummy cycles for all commands
-
-          sPAL_Qsf.Mode = PAL_QSPI_DDR_BURST;
-          sPAL_Qsf.DummyCycles = 8u;
-          sPAL_Qsf.DummyCyclesEC= 6u;
-          sPAL_Qsf.DummyCyclesEE = 8u;
-          break;
-
-        case PAL_SDF_TYPE_MICRON: // id=0x20 3V3 device BA and BB
-          sPAL_Qsf.Mode = PAL_QSPI_DDR_BURST;
-          sPAL_Qsf.DummyCycles = 8u;
-          sPAL_Qsf.DummyCyclesEC = 10u;
-          sPAL_Qsf.DummyCyclesEE = 8u;
-          break;
-
-        case PAL_SDF_TYPE_CYPRESS: // id=0x01 128Mb device 20 and 02
-          status = u_Qsf_WriteEnable();
-          status = u_Qsf_WriteCommandData ( 0x71u, 0x02u, 8u, 0x00800002u); // CR1V, (still with 3-byte addressing)
-
-          status = u_Qsf_WriteEnable();
-          status = u_Qsf_WriteCommandData ( 0x71u, 0x07u, 8u, 0x00800003u); // CR2V
-          // PRQA S 2982 --
-          sPAL_Qsf.DummyCycles = 7u;
-          sPAL_Qsf.DummyCyclesEC = 7u;
-          sPAL_Qsf.DummyCyclesEE = 7u;
-
-          sPAL_Qsf.Mode = PAL_QSPI_SDR_BURST;
-          break;
-
-        default:
-          status = (Std_ReturnType)PAL_QSF_ERROR_NOTSUPPORTED;
-          sPAL_Qsf.Mode = PAL_SPI_SDR_BURST;
-          break;
-        }
-
-        PAL_v_QsfDDRCalibration();
-        uint8 u_calibratedStrtimValue_res = u_calibratedStrtimValue;
-        if(u_calibratedStrtimValue_res >= 0x08u)
-        {
-          sPAL_Qsf.Mode = PAL_QSPI_SDR_BURST;
-        }
-        else
-        {
-          // do nothing
+          switch (id)
+          {
+          case 0xC2u:  // device 25
+            sPAL_Qsf.Type=PAL_SDF_TYPE_MACRONIX;
+            break;
+          case 0x20u: // 3V3 device BA and BB
+            sPAL_Qsf.Type=PAL_SDF_TYPE_MICRON;
+            break;
+          case 0x01u: // 128Mb device 20 and 02
+            sPAL_Qsf.Type=PAL_SDF_TYPE_CYPRESS;
+            break;
+          default:
+            sPAL_Qsf.Type=PAL_SDF_TYPE_UNKNOWN;
+            break;
+          }
+
+          switch (sPAL_Qsf.Type)
+          {
+          case PAL_SDF_TYPE_MACRONIX:  // id=0xC2 device 25
+            // Return from secured OTP area to main memory array.
+            // EXSO (C1h)
+            // This is necessary to ensure that SDF is returned to main memory region with each request
+            status = u_Qsf_WriteCommandData(0xC1u,0x0,0x0,0x0);
+
+            status = u_Qsf_WriteEnable();
+            status = u_Qsf_WriteCommandData ( 0x01u, (uint32)(0x87uL << 8u) | 0x40u, 16u, 0u );
+            // status=0x40 QE bit
+            // config[2..0]=b111 default output driver strength (24 Ohms)
+            // config[7..6]=b10  8 dummy cycles for all commands
+
+            sPAL_Qsf.Mode = PAL_QSPI_DDR_BURST;
+            sPAL_Qsf.DummyCycles = 8u;
+            sPAL_Qsf.DummyCyclesEC= 6u;
+            sPAL_Qsf.DummyCyclesEE = 8u;
+            break;
+
+          case PAL_SDF_TYPE_MICRON: // id=0x20 3V3 device BA and BB
+#if (PAL_QSF_CONTINUOUS_READ == STD_ON)
+            // VCR bit3 = 0: XIP is entered and left with the confirmation bit of the mode bits
+            status = u_Qsf_ReadCommandData ( &vcr, 0x85u, 8u, 0u );
+            if ( status == E_OK )
+            {
+              status = u_Qsf_WriteEnable();
+            }
+            if ( status == E_OK )
+            {
+              status = u_Qsf_WriteCommandData ( 0x81u, vcr & ~(uint32)0x08u, 8u, 0u );
+            }
+#endif
+            sPAL_Qsf.Mode = PAL_QSPI_DDR_BURST;
+            sPAL_Qsf.DummyCycles = 8u;
+            sPAL_Qsf.DummyCyclesEC = 10u;
+            sPAL_Qsf.DummyCyclesEE = 8u;
+            break;
+
+          case PAL_SDF_TYPE_CYPRESS: // id=0x01 128Mb device 20 and 02
+            status = u_Qsf_WriteEnable();
+            status = u_Qsf_WriteCommandData ( 0x71u, 0x02u, 8u, 0x00800002u); // CR1V, (still with 3-byte addressing)
+
+            status = u_Qsf_WriteEnable();
+            status = u_Qsf_WriteCommandData ( 0x71u, 0x07u, 8u, 0x00800003u); // CR2V
+            // PRQA S 2982 --
+            sPAL_Qsf.DummyCycles = 7u;
+            sPAL_Qsf.DummyCyclesEC = 7u;
+            sPAL_Qsf.DummyCyclesEE = 7u;
+
+            sPAL_Qsf.Mode = PAL_QSPI_SDR_BURST;
+            break;
+
+          default:
+            status = (Std_ReturnType)PAL_QSF_ERROR_NOTSUPPORTED;
+            sPAL_Qsf.Mode = PAL_SPI_SDR_BURST;
+            break;
+          }
+
+          PAL_v_QsfDDRCalibration();
+          uint8 u_calibratedStrtimValue_res = u_calibratedStrtimValue;
+          if(u_calibratedStrtimValue_res >= 0x08u)
+          {
+            sPAL_Qsf.Mode = PAL_QSPI_SDR_BURST;
+          }
+          else
+          {
+            // do nothing
+          }
         }
       }
-    }
 
 
+    }
+    if (status == E_OK)
+    {
+      u_ProbedSpClkFreq = SPCLKfreq;
+    }
   }
 
   return(status );
 }
+
+void PAL_v_QsfForceColdInit(void)
+{
+  u_ProbedSpClkFreq = (uint32)PAL_QSF_SPCLK_ZERO;
+}
+
+Std_ReturnType PAL_u_QsfAbort(void)
+// Function: aborts a running program/erase operation with a software reset of the device
+// Return values:
+// PAL_QSF_OK       reset sent
+// PAL_QSF_ERROR_TIMEOUT    operation timed out
+{
+  Std_ReturnType status;
+
+  status = u_Qsf_SendCommand(0x66u);      // cmd 0x66 RSTEN: reset enable
+  if ( status == E_OK )
+  {
+    status = u_Qsf_SendCommand(0x99u);    // cmd 0x99 RST: reset device
+  }
+  // the reset restores the power-on configuration of the device and leaves the continuous read mode
+  b_ContinuousRead = FALSE;
+  b_ReadCacheDirty = TRUE;
+  u_ProbedSpClkFreq = (uint32)PAL_QSF_SPCLK_ZERO;
+
+  return status;
+}
 // PRQA S 7002 --
 
+static Std_ReturnType u_Qsf_SetPartitionParameters(const Fls_ConfigType* ConfigPtr)
+// Function: sets the access parameters depending on the size of the configured write window
+// Return values:
+// PAL_QSF_OK       parameters set successfully
+{
+  Std_ReturnType status;
+
+  // page and sector of all devices are accessed together, the device size is limited by the address window
+  if(ConfigPtr->u_WriteWindowSize <= 0x10000uL)
+  {
+    // set default parameters for this library
+    status = u_Qsf_SetParameters( PAL_QSF_DEVICE_CNT*256u, PAL_QSF_DEVICE_CNT*4u*KiB, 64u*MiB, 5000u, 3000u );// for smaller partition
+  }
+  else
+  {
+    status = u_Qsf_SetParameters( PAL_QSF_DEVICE_CNT*256u, PAL_QSF_DEVICE_CNT*64u*KiB, 64u*MiB, 5000u, 3000u );// for bigger partition
+  }
+
+  return status;
+}
+
 Std_ReturnType Pal_u_Qsf_SetSectorSize (uint32 SectorSizeBytes)
 // Function: sets the parameters for QSPI flash device access
 // Return values:
@@ -1287,7 +1497,8 @@ Std_ReturnType Pal_u_Qsf_SetSectorSize (uint32 SectorSizeBytes)
 // PAL_QSF_ERROR_SIZE  SectorSizeBytes is no multiple of 4k;
 {
   Std_ReturnType status = E_OK;
-  if (!(( SectorSizeBytes == 4u*KiB) || ( SectorSizeBytes == 32u*KiB) || ( SectorSizeBytes == 64u*KiB)))
+  uint32 DevSectorSize = SectorSizeBytes / PAL_QSF_DEVICE_CNT;
+  if (!(( DevSectorSize == 4u*KiB) || ( DevSectorSize == 32u*KiB) || ( DevSectorSize == 64u*KiB)))
   {
     status = (Std_ReturnType)PAL_QSF_ERROR_SIZE;
   }
@@ -1336,11 +1547,16 @@ static Std_ReturnType u_Qsf_ReadID(uint8 *ManufacturerID, uint16 *DeviceID)
 // Return values:
 // PAL_QSF_OK       OK, ID read successfully
 // PAL_QSF_ERROR_TIMEOUT    operation timed out
+// PAL_QSF_ERROR_NOTSUPPORTED  IDs of the parallel devices differ
 {
   Std_ReturnType status = (Std_ReturnType)PAL_QSF_OK;
   uint32 data32;
 
   status = u_Qsf_ReadCommandData(&data32, 0x9Fu, 32u, 0u);
+  if ( ( status == E_OK ) && ( u_DualDiff != 0u ) )
+  {
+    status = (Std_ReturnType)PAL_QSF_ERROR_NOTSUPPORTED; // devices of different type
+  }
   if ( status == E_OK )
   {
     if ( ManufacturerID   != NULL )
@@ -1357,6 +1573,29 @@ static Std_ReturnType u_Qsf_ReadID(uint8 *ManufacturerID, uint16 *DeviceID)
   return((Std_ReturnType)status);
 }
 
+#if (PAL_QSF_DUAL_FLASH == STD_ON)
+static uint32 u_Qsf_DualData(uint32 data)
+// Function: duplicates the lower two data bytes for both devices, in transfer order (even byte to the first device)
+{
+  uint32 lo = data & 0xFFu;
+  uint32 hi = (data >> 8u) & 0xFFu;
+
+  return ( lo | (lo << 8u) | (hi << 16u) | (hi << 24u) );
+}
+
+static uint32 u_Qsf_DualSplit(uint32 first, uint32 second, uint32 *dev1)
+// Function: splits up to 8 received bytes into the data of both devices
+// Return values:
+// data of the first device (even bytes), the data of the second device (odd bytes) is written to dev1
+{
+  uint32 dev0 =  (first         & 0xFFu)         | ((first >> 8u)  & 0xFF00u) |
+                ((second << 16u) & 0x00FF0000u)  | ((second << 8u) & 0xFF000000u);
+  *dev1       = ((first >> 8u)  & 0xFFu)         | ((first >> 16u) & 0xFF00u) |
+                ((second << 8u)  & 0x00FF0000u)  |  (second        & 0xFF000000u);
+  return dev0;
+}
+#endif
+
 static Std_ReturnType u_Qsf_WriteCommandData(uint8 cmd, uint32 data, uint32 size, uint32 addr)
 // Function: sends the command followed by data
 // Return values:
@@ -1366,7 +1605,12 @@ static Std_ReturnType u_Qsf_WriteCommandData(uint8 cmd, uint32 data, uint32 size
   Std_ReturnType status;
   uint32 writeData;
 
-  switch(size)
+  v_Qsf_ExitContinuousRead();
+#if (PAL_QSF_DUAL_FLASH == STD_ON)
+  // every device receives its own copy of each data byte
+  data = u_Qsf_DualData(data);
+#endif
+  switch(size * PAL_QSF_DEVICE_CNT)
   {
   case 8u:
     writeData = ( (data & (uint32)0xFF) << 24u ); // shift by 24 required
@@ -1382,7 +1626,7 @@ static Std_ReturnType u_Qsf_WriteCommandData(uint8 cmd, uint32 data, uint32 size
   SFR32( RPC_DRCR   ) = 0x01000000u;    // Data read control        negate SSL in case still in continuous read mode
   SFR32( RPC_OFFSET1    ) = 0x31511144u;    // PHY timing offset        set PHY read mode to SDR
   SFR32( RPC_PHYCNT ) = 0x80030260u;    // PHY control          PHYMEM[1:0] = 2'b00: Serial Flash SDR;  CAL = 1: PHY calibration
-  SFR32( RPC_CMNCR  ) = 0x81FFF300u;    // Common control       BSZ[1:0] = 2'b00: Serial Flash (1ch);  MD = 1: Manual mode
+  SFR32( RPC_CMNCR  ) = PAL_QSF_CMNCR(0x81FFF300u);    // Common control       BSZ[1:0] = PAL_QSF_CMNCR_BSZ;  MD = 1: Manual mode
   SFR32( RPC_SMCMR  ) = ((uint32) cmd) << 16u; // Manual mode command       CMD[7:0] = 8'h05 = RDSR1: Read status register 1
   SFR32( RPC_SMDRENR    ) = 0x00000000u;    // Manual mode DDR enable   HYPE = 3'b000: SPI Flash;  SPIDRE = 0: data SDR transfer
 
@@ -1442,6 +1686,61 @@ static Std_ReturnType u_Qsf_WriteCommandData(uint8 cmd, uint32 data, uint32 size
   return ( status );
 }
 
+static Std_ReturnType u_Qsf_SendCommand(uint8 cmd)
+// Function: sends a command without data, does not wait for the device (accepted while WIP is set)
+// Return values:
+// PAL_QSF_OK       operation complete
+// PAL_QSF_ERROR_TIMEOUT    operation timed out
+{
+  v_Qsf_ExitContinuousRead();
+    		// PRQA S 0303 8 //0303_SFR_32
+  SFR32( RPC_DRCR   ) = 0x01000000u;    // Data read control        negate SSL in case still in continuous read mode
+  SFR32( RPC_OFFSET1    ) = 0x31511144u;    // PHY timing offset        set PHY read mode to SDR
+  SFR32( RPC_PHYCNT ) = 0x80030260u;    // PHY control          PHYMEM[1:0] = 2'b00: Serial Flash SDR;  CAL = 1: PHY calibration
+  SFR32( RPC_CMNCR  ) = PAL_QSF_CMNCR(0x81FFF300u);    // Common control       BSZ[1:0] = PAL_QSF_CMNCR_BSZ;  MD = 1: Manual mode
+  SFR32( RPC_SMCMR  ) = ((uint32) cmd) << 16u; // Manual mode command       CMD[7:0]
+  SFR32( RPC_SMDRENR    ) = 0x00000000u;    // Manual mode DDR enable   HYPE = 3'b000: SPI Flash;  SPIDRE = 0: data SDR transfer
+  SFR32( RPC_SMENR  ) = 0x00004000u;    // Manual mode enable       CDE = 1: Command enabled, no address and data
+  SFR32( RPC_SMCR   ) = 0x00000001u;    // Manual mode control      SPIRE = 0: Data read disabled;  SPIWE = 0: Data write disabled;  SPIE = 1: SPI transfer start
+
+  return u_Qsf_WaitTxEnd();
+}
+
+static void v_Qsf_SetOtpManualMode(uint8 cmd, uint32 addr)
+// Function: sets up manual mode for an OTP transfer, the data phases are started by the caller
+{
+    		// PRQA S 0303 7 //0303_SFR_32
+  SFR32( RPC_DRCR   ) = 0x01000000u;    // Data read control        negate SSL in case still in continuous read mode
+  SFR32( RPC_OFFSET1    ) = 0x31511144u;    // PHY timing offset        set PHY read mode to SDR
+  SFR32( RPC_PHYCNT ) = 0x80030260u;    // PHY control          PHYMEM[1:0] = 2'b00: Serial Flash SDR;  CAL = 1: PHY calibration
+  SFR32( RPC_CMNCR  ) = PAL_QSF_CMNCR(0x81FFF300u);    // Common control       BSZ[1:0] = PAL_QSF_CMNCR_BSZ;  MD = 1: Manual mode
+  SFR32( RPC_SMCMR  ) = ((uint32) cmd) << 16u; // Manual mode command       CMD[7:0]
+  SFR32( RPC_SMDRENR    ) = 0x00000000u;    // Manual mode DDR enable   HYPE = 3'b000: SPI Flash;  SPIDRE = 0: data SDR transfer
+  SFR32( RPC_SMADR  ) = addr;
+}
+
+static uint32 u_Qsf_OtpChunk(uint32 left, uint32 *p_Spide)
+// Function: returns the size of the next data phase, a 3 byte rest is sent as 16-bit and 8-bit data
+{
+  uint32 cnt;
+
+  if(left >= 4u)
+  {
+    cnt = 4u;
+    *p_Spide = 0x0000000Fu;   // SPIDE[3:0] = 1111 : 32-bit data
+  }else if(left >= 2u)
+  {
+    cnt = 2u;
+    *p_Spide = 0x0000000Cu;   // SPIDE[3:0] = 1100 : 16-bit data
+  }else
+  {
+    cnt = 1u;
+    *p_Spide = 0x00000008u;   // SPIDE[3:0] = 1000 : 8-bit data
+  }
+
+  return cnt;
+}
+
 static Std_ReturnType u_Qsf_ReadCommandData(uint32 *read, uint8 cmd, uint32 size, uint32 addr)
 // Function: sends the command followed by data
 // Return values:
@@ -1450,11 +1749,13 @@ static Std_ReturnType u_Qsf_ReadCommandData(uint32 *read, uint8 cmd, uint32 size
 {
   Std_ReturnType    status;
   uint32 data32;
+
+  v_Qsf_ExitContinuousRead();
     		// PRQA S 0303 6 //0303_SFR_32
   SFR32( RPC_DRCR   ) = 0x01000000u;    // Data read control        negate SSL in case still in continuous read mode
   SFR32( RPC_OFFSET1    ) = 0x31511144u;    // PHY timing offset        set PHY read mode to SDR
   SFR32( RPC_PHYCNT ) = 0x80030260u;    // PHY control          PHYMEM[1:0] = 2'b00: Serial Flash SDR;  CAL = 1: PHY calibration
-  SFR32( RPC_CMNCR  ) = 0x81FFF300u;    // Common control       BSZ[1:0] = 2'b00: Serial Flash (1ch);  MD = 1: Manual mode
+  SFR32( RPC_CMNCR  ) = PAL_QSF_CMNCR(0x81FFF300u);    // Common control       BSZ[1:0] = PAL_QSF_CMNCR_BSZ;  MD = 1: Manual mode
   SFR32( RPC_SMCMR  ) = ((uint32) cmd) << 16u; // Manual mode command       CMD[7:0] = 8'h05 = RDSR1: Read status register 1
   SFR32( RPC_SMDRENR    ) = 0x00000000u;    // Manual mode DDR enable   HYPE = 3'b000: SPI Flash;  SPIDRE = 0: data SDR transfer
   if(addr==0u)
@@ -1500,8 +1801,24 @@ static Std_ReturnType u_Qsf_ReadCommandData(uint32 *read, uint8 cmd, uint32 size
 
   status = u_Qsf_WaitTxEnd();
   if ( status == (Std_ReturnType)PAL_QSF_OK )
-  {    		// PRQA S 0303 1 //0303_SFR_32
+  {
+#if (PAL_QSF_DUAL_FLASH == STD_ON)
+    // the flags of both devices are combined, differing bits are kept for the ID check
+    uint32 dev1;
+    if ( size == 32u )
+    {    		// PRQA S 0303 1 //0303_SFR_32
+      data32 = u_Qsf_DualSplit( SFR32( RPC_SMRDR1 ), SFR32( RPC_SMRDR0 ), &dev1 );
+    }
+    else
+    {    		// PRQA S 0303 1 //0303_SFR_32
+      data32 = u_Qsf_DualSplit( SFR32( RPC_SMRDR0 ), 0u, &dev1 );
+    }
+    u_DualDiff = data32 ^ dev1;
+    data32 |= dev1;
+#else
+    		// PRQA S 0303 1 //0303_SFR_32
     data32 = SFR32( RPC_SMRDR0 );
+#endif
     switch (size)
     {
     case 8u:
@@ -1588,6 +1905,8 @@ Std_ReturnType u_Qsf_WriteEnable(void)
 // PAL_QSF_OK       OK, operation completed successfully or idle
 // PAL_QSF_ERROR_TIMEOUT    operation timed out
 {
+  // every program and erase command starts with a write enable
+  b_ReadCacheDirty = TRUE;
   return( u_Qsf_WriteCommandData ( 0x06u, 0u, 0u, 0u ) );
 }
 
@@ -1596,6 +1915,67 @@ Std_ReturnType u_Qsf_WriteEnable(void)
 // Reason:  Not critical, too many if/else statements
 // PRQA S 7002 ++
 
+static void v_Qsf_ExitContinuousRead(void)
+// Function: resets the mode bits of the device, so the next transfer starts with a command
+{
+  if ( b_ContinuousRead == TRUE )
+  {
+    b_ContinuousRead = FALSE;
+    		// PRQA S 0303 10 //0303_SFR_32
+    SFR32( RPC_DRCR   ) = 0x01000000u;    // Data read control        negate SSL to end the continuous read
+    SFR32( RPC_OFFSET1    ) = 0x31511144u;    // PHY timing offset        set PHY read mode to SDR
+    SFR32( RPC_PHYCNT ) = 0x80030260u;    // PHY control          PHYMEM[1:0] = 2'b00: Serial Flash SDR;  CAL = 1: PHY calibration
+    SFR32( RPC_CMNCR  ) = PAL_QSF_CMNCR(0x81FFF300u);    // Common control       BSZ[1:0] = PAL_QSF_CMNCR_BSZ;  MD = 1: Manual mode
+    SFR32( RPC_SMCMR  ) = 0x00000000u;    // Manual mode command      not output
+    SFR32( RPC_SMADR  ) = 0xFFFFFFFFu;    // Manual mode address      all data lines high
+    SFR32( RPC_SMOPR  ) = 0xFFFFFFFFu;    // Manual mode option data  mode bits 0xFF: leave continuous read
+    SFR32( RPC_SMDRENR    ) = 0x00000000u;    // Manual mode DDR enable   HYPE = 3'b000: SPI Flash;  SDR transfer
+    SFR32( RPC_SMENR  ) = 0x02200FF0u;    // Manual mode enable       ADB  [1:0] = 2'b10: 4-bit address (DIO[3:0])
+    //              OPDB [1:0] = 2'b10: 4-bit option data (DIO[3:0])
+    //              CDE        =    0 : Command disabled
+    //              ADE  [3:0] = 1111 : ADR[31:0] output
+    //              OPDE [3:0] = 1111 : OPD3..OPD0 output (16 clocks with all data lines high)
+    //              SPIDE[3:0] = 0000 : data disabled
+    SFR32( RPC_SMCR   ) = 0x00000001u;    // Manual mode control      SPIRE = 0: Data read disabled;  SPIWE = 0: Data write disabled;  SPIE = 1: SPI transfer start
+    (void)u_Qsf_WaitTxEnd();
+  }
+}
+
+#if (PAL_QSF_CONTINUOUS_READ == STD_ON)
+static void v_Qsf_SetContinuousRead(e_PAL_QspiMode Mode)
+// Function: sends the mode bits with the external address space read, omits the command if the device is already in continuous read mode
+{
+  uint32 u_Drenr;
+  uint32 u_Drdmcr;
+  uint32 u_ModeBits;
+  e_PAL_SdfType type_res = sPAL_Qsf.Type;
+
+  if ( (type_res == PAL_SDF_TYPE_MACRONIX) || (type_res == PAL_SDF_TYPE_MICRON) )
+  {
+    u_ModeBits = (type_res == PAL_SDF_TYPE_MACRONIX) ? PAL_QSF_MODE_BITS_MACRONIX : PAL_QSF_MODE_BITS_MICRON;
+    		// PRQA S 0303 2 //0303_SFR_32
+    u_Drenr  = SFR32( RPC_DRENR  );
+    u_Drdmcr = SFR32( RPC_DRDMCR );
+    if ( (u_Drenr & 0x000000F0u) == 0u )
+    {
+      // the mode bits take the first dummy cycles: 2 cycles in SDR, 1 cycle in DDR
+      u_Drdmcr -= (Mode == PAL_QSPI_SDR_BURST) ? 2u : 1u;
+      u_Drenr  |= 0x00200080u;            // OPDB[1:0] = 2'b10: 4-bit option data;  OPDE[3:0] = 1000: OPD3 output
+    }
+    if ( b_ContinuousRead == TRUE )
+    {
+      u_Drenr &= ~(uint32)0x00004000u;    // CDE = 0: command is not output
+    }
+    		// PRQA S 0303 3 //0303_SFR_32
+    SFR32( RPC_DROPR  ) = u_ModeBits << 24u; // Data read option data OPD3 = mode bits
+    SFR32( RPC_DRENR  ) = u_Drenr;
+    SFR32( RPC_DRDMCR ) = u_Drdmcr;
+    // the caller accesses the window right after u_Qsf_StartRead, which enters the mode
+    b_ContinuousRead = TRUE;
+  }
+}
+#endif
+
 static Std_ReturnType u_Qsf_StartRead(uint32 FlashAddr, uint32 SizeBytes)
 // Function: prepares to read data from the QSPI flash
 // Return values:
@@ -1604,6 +1984,7 @@ static Std_ReturnType u_Qsf_StartRead(uint32 FlashAddr, uint32 SizeBytes)
 // PAL_QSF_ERROR_SIZE   accessing flash outside of bounds
 {
   uint32    FlashAddrEnd;
+  uint32    u_Rcf;
 
   Std_ReturnType status = E_OK;
   uint32 DeviceSize_res = sPAL_Qsf.DeviceSize;
@@ -1637,13 +2018,17 @@ static Std_ReturnType u_Qsf_StartRead(uint32 FlashAddr, uint32 SizeBytes)
       // do nothing
     }
 
+    // program/erase commands and the calibration leave stale data in the read cache
+    u_Rcf = ((PAL_QSF_READ_CACHE_FLUSH == STD_ON) || (b_ReadCacheDirty == TRUE)) ? 1u : 0u;
+    b_ReadCacheDirty = FALSE;
+
       e_PAL_QspiMode Mode_res =  sPAL_Qsf.Mode;
     if (Mode_res == PAL_SPI_SDR_BURST) // (single) SPI, SDR, burst access
     {    		// PRQA S 0303 7 //0303_SFR_32
       SFR32( RPC_OFFSET1  ) = 0x31511144u;    // PHY timing offset        set PHY read mode to SDR
       SFR32( RPC_PHYCNT   ) = 0x80000260u;    // PHY control          PHYMEM[1:0] = 2'b00: Serial Flash SDR;  CAL = 1: PHY calibration;  HS = 0: normal read response
-      SFR32( RPC_CMNCR    ) = 0x01FFF300u;    // Common control       BSZ[1:0] = 2'b00: Serial Flash (1ch);  MD = 0: External address space mode
-      SFR32( RPC_DRCR ) = 0x011F0300u;        // Data read control        RBURST = 5'h1F: read burst length is 32 units of 64-bit = 256 bytes;  RBE = 1: read bursts enabled;  RCF = 1: read cache flush
+      SFR32( RPC_CMNCR    ) = PAL_QSF_CMNCR(0x01FFF300u);    // Common control       BSZ[1:0] = PAL_QSF_CMNCR_BSZ;  MD = 0: External address space mode
+      SFR32( RPC_DRCR ) = PAL_QSF_DRCR(u_Rcf, 1u, 0u); // Data read control   RBURST: PAL_QSF_READ_BURST_LEN units of 64-bit;  RBE = 1: read bursts enabled;  RCF: read cache flush
       SFR32( RPC_DRCMR    ) = 0x000B0000u;    // Data read command        CMD[7:0] = 8'h0B = FAST_READ
       SFR32( RPC_DRENR    ) = 0x0000C700u;    // Data read enable     CDB  [1:0] = 2'b00: 1-bit command (MOSI/MISO)
       //              ADB  [1:0] = 2'b00: 1-bit address (MOSI/MISO)
@@ -1664,8 +2049,8 @@ static Std_ReturnType u_Qsf_StartRead(uint32 FlashAddr, uint32 SizeBytes)
  		  // PRQA S 0303 7 //0303_SFR_32
       SFR32( RPC_OFFSET1  ) = 0x31511144u;    // PHY timing offset        set PHY read mode to SDR
       SFR32( RPC_PHYCNT   ) = 0x80000260u;    // PHY control          PHYMEM[1:0] = 2'b00: Serial Flash SDR;  CAL = 1: PHY calibration;  HS = 0: normal read response
-      SFR32( RPC_CMNCR    ) = 0x01557300u;    // Common control       BSZ[1:0] = 2'b00: Serial Flash (1ch);  MD = 0: External address space mode
-      SFR32( RPC_DRCR ) = 0x011F0300u;        // Data read control        RBURST = 5'h1F: read burst length is 32 units of 64-bit = 256 bytes;  RBE = 1: read bursts enabled;  RCF = 1: read cache flush
+      SFR32( RPC_CMNCR    ) = PAL_QSF_CMNCR(0x01557300u);    // Common control       BSZ[1:0] = PAL_QSF_CMNCR_BSZ;  MD = 0: External address space mode
+      SFR32( RPC_DRCR ) = PAL_QSF_DRCR(u_Rcf, 1u, 0u); // Data read control   RBURST: PAL_QSF_READ_BURST_LEN units of 64-bit;  RBE = 1: read bursts enabled;  RCF: read cache flush
       SFR32( RPC_DRCMR    ) = 0x00EC0000u;    // Data read command        CMD[7:0] = 8'hEC = 4QIOR = 4-byte address SDR Quad I/O Fast Read
       // PRQA S 4461 1 // 4461_UL_Warning
       SFR32( RPC_DRENR    ) = 0x0222CF00uL |
@@ -1691,8 +2076,8 @@ static Std_ReturnType u_Qsf_StartRead(uint32 FlashAddr, uint32 SizeBytes)
       e_PAL_SdfType type_res =  sPAL_Qsf.Type;
       SFR32( RPC_OFFSET1  ) = 0x21511144u;    // PHY timing offset        set PHY read mode to DDR
       SFR32( RPC_PHYCNT   ) = 0x80000261u;    // PHY control          PHYMEM[1:0] = 2'b01: Serial Flash DDR;  CAL = 1: PHY calibration;  HS = 0: normal read response
-      SFR32( RPC_CMNCR    ) = 0x01557300u;    // Common control       BSZ[1:0] = 2'b00: Serial Flash (1ch);  MD = 0: External address space mode
-      SFR32( RPC_DRCR     ) = 0x011F0200u;    // Data read control        RBE = 0: read bursts disabled
+      SFR32( RPC_CMNCR    ) = PAL_QSF_CMNCR(0x01557300u);    // Common control       BSZ[1:0] = PAL_QSF_CMNCR_BSZ;  MD = 0: External address space mode
+      SFR32( RPC_DRCR     ) = PAL_QSF_DRCR(u_Rcf, 0u, 0u); // Data read control   RBE = 0: read bursts disabled;  RCF: read cache flush
       SFR32( RPC_DRCMR    ) = 0x00EE0000u;    // Data read command        CMD[7:0] = 8'hEE = 4DDRQIOR = 4-byte address DDR Quad I/O Fast Read
       // PRQA S 4461 1 // 4461_UL_Warning
       SFR32( RPC_DRENR    ) = 0x0222CF00uL |
@@ -1717,8 +2102,8 @@ static Std_ReturnType u_Qsf_StartRead(uint32 FlashAddr, uint32 SizeBytes)
       e_PAL_SdfType type_res =  sPAL_Qsf.Type;
       SFR32( RPC_OFFSET1  ) = 0x21511144u;    // PHY timing offset        set PHY read mode to DDR
       SFR32( RPC_PHYCNT   ) = 0x00080261u | (uint32)((uint32)u_calibratedStrtimValue << 15u);
-      SFR32( RPC_CMNCR    ) = 0x01557300u;    // Common control       BSZ[1:0] = 2'b00: Serial Flash (1ch);  MD = 0: External address space mode
-      SFR32( RPC_DRCR     ) = 0x011F0301u;    // Data read control        RBURST = 5'h1F: read burst length is 32 units of 64-bit = 256 bytes;  RBE = 1: read bursts enabled;  RCF = 1: read cache flush;  SSLE = 1: continuous read
+      SFR32( RPC_CMNCR    ) = PAL_QSF_CMNCR(0x01557300u);    // Common control       BSZ[1:0] = PAL_QSF_CMNCR_BSZ;  MD = 0: External address space mode
+      SFR32( RPC_DRCR     ) = PAL_QSF_DRCR(u_Rcf, 1u, 1u); // Data read control   RBURST: PAL_QSF_READ_BURST_LEN units of 64-bit;  RBE = 1: read bursts enabled;  RCF: read cache flush;  SSLE = 1: continuous read
       SFR32( RPC_DRCMR    ) = 0x00EE0000u;    // Data read command        CMD[7:0] = 8'hEE = 4DDRQIOR = 4-byte address DDR Quad I/O Fast Read
       // PRQA S 4461 1 // 4461_UL_Warning
       SFR32( RPC_DRENR    ) = 0x0222CF00uL |
@@ -1742,6 +2127,12 @@ static Std_ReturnType u_Qsf_StartRead(uint32 FlashAddr, uint32 SizeBytes)
     {
       status = (Std_ReturnType)PAL_QSF_ERROR_NOTSUPPORTED;
     }
+#if (PAL_QSF_CONTINUOUS_READ == STD_ON)
+    if ( (status == E_OK) && (Mode_res != PAL_SPI_SDR_BURST) )
+    {
+      v_Qsf_SetContinuousRead(Mode_res);
+    }
+#endif
   }
   if(status == E_OK)
   {
@@ -1782,7 +2173,7 @@ static Std_ReturnType u_Qsf_ReadRPCWindow(uint32 FlashAddr, uint8 *RAMptr, uint3
       v_Qsf_SyncMemories();
 #else
       #ifndef SIM_SCT_CFG //Not Courage
-      (void)Qsf_memcpy((void*)RAMptr, (void*)(PAL_QSF_WINDOW_START + (FlashAddr & PAL_QSF_WINDOW_MASK)), SizeBytes);
+      v_Qsf_WindowCopy(RAMptr, PAL_QSF_WINDOW_START + (FlashAddr & PAL_QSF_WINDOW_MASK), SizeBytes);
       #endif //SIM_SCT_CFG
 #endif
       }
@@ -1790,6 +2181,84 @@ static Std_ReturnType u_Qsf_ReadRPCWindow(uint32 FlashAddr, uint8 *RAMptr, uint3
   return( status );
 }
 
+static void v_Qsf_WindowCopy(uint8 *RAMptr, uint32 WindowAddr, uint32 SizeBytes)
+// Function: copies data from the external address space to RAM
+{
+#if (PAL_QSF_BURST_COPY == STD_ON)
+  // bytes up to the next read burst boundary of the source
+  uint32 u_Head = (PAL_QSF_READ_BURST_BYTES - (WindowAddr % PAL_QSF_READ_BURST_BYTES)) % PAL_QSF_READ_BURST_BYTES;
+  uint32 u_Bursts;
+  uint32 u_Blocks;
+  const uint32 *p_Src32;
+  uint32 *p_Dst32;
+  uint32 u_W0, u_W1, u_W2, u_W3, u_W4, u_W5, u_W6, u_W7;
+
+  if (u_Head > SizeBytes)
+  {
+    u_Head = SizeBytes;
+  }
+  // block copy needs a word aligned destination once the source is aligned
+  // PRQA S 0306 1 // summary: cast of the RAM pointer to check its alignment
+  if ((((uint32)RAMptr + u_Head) & 0x3u) != 0u)
+  {
+    u_Head = SizeBytes;
+  }
+  // PRQA S 0326,0314,1496 1 // same as Qsf_memcpy use in u_Qsf_ReadRPCWindow
+  (void)Qsf_memcpy((void*)RAMptr, (void*)WindowAddr, u_Head);
+  SizeBytes -= u_Head;
+  u_Bursts = SizeBytes / PAL_QSF_READ_BURST_BYTES;
+  // PRQA S 0306,0310,3305 2 // summary: window address and RAM buffer are accessed as words, alignment is ensured above
+  p_Src32 = (const uint32 *)(WindowAddr + u_Head);
+  p_Dst32 = (uint32 *)&RAMptr[u_Head];
+  while (u_Bursts != 0u)
+  {
+    for (u_Blocks = PAL_QSF_READ_BURST_BYTES >> 5u; u_Blocks != 0u; u_Blocks--)
+    {
+      // eight loads and eight stores in a row allow the compiler to use LDM/STM
+      u_W0 = p_Src32[0]; u_W1 = p_Src32[1]; u_W2 = p_Src32[2]; u_W3 = p_Src32[3];
+      u_W4 = p_Src32[4]; u_W5 = p_Src32[5]; u_W6 = p_Src32[6]; u_W7 = p_Src32[7];
+      p_Dst32[0] = u_W0; p_Dst32[1] = u_W1; p_Dst32[2] = u_W2; p_Dst32[3] = u_W3;
+      p_Dst32[4] = u_W4; p_Dst32[5] = u_W5; p_Dst32[6] = u_W6; p_Dst32[7] = u_W7;
+      // PRQA S 0488 2 // pointer arithmetic on the copy pointers
+      p_Src32 += 8u;
+      p_Dst32 += 8u;
+    }
+    u_Bursts--;
+  }
+  // PRQA S 0326,0314,1496 1 // same as Qsf_memcpy use in u_Qsf_ReadRPCWindow
+  (void)Qsf_memcpy((void*)p_Dst32, (const void*)p_Src32, SizeBytes % PAL_QSF_READ_BURST_BYTES);
+#else
+  // PRQA S 0326,0314,1496,4461 1 // same as Qsf_memcpy use in u_Qsf_ReadRPCWindow
+  (void)Qsf_memcpy((void*)RAMptr, (void*)WindowAddr, SizeBytes);
+#endif
+}
+
+#if (PAL_QSF_BENCHMARK == STD_ON)
+void PAL_v_QsfReadBenchmark(uint32 FlashAddr, uint8 *RAMptr, uint32 SizeBytes, uint32 *p_Result_us)
+// Function: measures the copy time of Qsf_memcpy and of the block copy for a range in the external address space
+{
+  uint32 u_WindowAddr = PAL_QSF_WINDOW_START + (FlashAddr & PAL_QSF_WINDOW_MASK);
+  uint32 u_t;
+
+  // each run starts with a flushed read cache (DRCR.RCF), otherwise the second run copies cached data
+  b_ReadCacheDirty = TRUE;
+  if (u_Qsf_StartRead(FlashAddr, SizeBytes) == E_OK)
+  {
+    u_t = SYS_TimeGetCount();
+    // PRQA S 0326,0314,1496 1 // same as Qsf_memcpy use in u_Qsf_ReadRPCWindow
+    (void)Qsf_memcpy((void*)RAMptr, (void*)u_WindowAddr, SizeBytes);
+    p_Result_us[0] = SYS_TimeGetSince(u_t);
+
+    // same start conditions for the second run
+    b_ReadCacheDirty = TRUE;
+    (void)u_Qsf_StartRead(FlashAddr, SizeBytes);
+    u_t = SYS_TimeGetCount();
+    v_Qsf_WindowCopy(RAMptr, u_WindowAddr, SizeBytes);
+    p_Result_us[1] = SYS_TimeGetSince(u_t);
+  }
+}
+#endif
+
 Std_ReturnType PAL_u_QsfRead(uint32 FlashAddr, uint8 *RAMptr, uint32 SizeBytes)
 // Function: reads data from the QSPI flash
 // Return values:
@@ -2078,9 +2547,9 @@ Std_ReturnType PAL_u_QsfEraseSector(uint32 FlashAddr)
   if ( status == E_OK )
   {    		// PRQA S 0303 2 //0303_SFR_32
     SFR32( RPC_PHYCNT ) = 0x80030260u;     // PHY control          PHYMEM[1:0] = 2'b00: Serial Flash SDR;  CAL = 1: PHY calibration
-    SFR32( RPC_CMNCR  ) = 0x81FFF300u;     // Common control       BSZ[1:0] = 2'b00: Serial Flash (1ch);  MD = 1: Manual mode
+    SFR32( RPC_CMNCR  ) = PAL_QSF_CMNCR(0x81FFF300u);     // Common control       BSZ[1:0] = PAL_QSF_CMNCR_BSZ;  MD = 1: Manual mode
 
-    switch(sPAL_Qsf.SectorSize)
+    switch(sPAL_Qsf.SectorSize / PAL_QSF_DEVICE_CNT)
     {
       case 4u*KiB:
     		// PRQA S 0303 1 //0303_SFR_32
@@ -2096,7 +2565,7 @@ Std_ReturnType PAL_u_QsfEraseSector(uint32 FlashAddr)
         SFR32( RPC_SMCMR  ) = 0x00DC0000u; // Manual mode command     CMD[7:0] = 8'hDC = 64SE: Sector Erase 4 byte addressing
         break;
     }    		// PRQA S 0303 3 //0303_SFR_32
-    SFR32( RPC_SMADR  ) = FlashAddr;  // Manual mode address      address
+    SFR32( RPC_SMADR  ) = PAL_QSF_DEV_ADDR(FlashAddr);  // Manual mode address      address
     SFR32( RPC_SMDRENR    ) = 0x00000000u;    // Manual mode DDR enable   HYPE = 3'b000: SPI Flash;  ADDRE = 0: address SDR transfer;  SPIDRE = 0: data SDR transfer
     SFR32( RPC_SMENR  ) = 0x00004F00u; // Manual mode enable   CDB  [1:0] = 2'b00: 1-bit command (MOSI/MISO)
     //        ADB  [1:0] = 2'b00: 1-bit address (MOSI/MISO)
@@ -2141,9 +2610,9 @@ Std_ReturnType PAL_u_QsfEraseSector_4K(uint32 FlashAddr)
     if ( status == E_OK )
     {    		// PRQA S 0303 6 //0303_SFR_32
       SFR32( RPC_PHYCNT ) = 0x80030260u;      // PHY control          PHYMEM[1:0] = 2'b00: Serial Flash SDR;  CAL = 1: PHY calibration
-      SFR32( RPC_CMNCR  ) = 0x81FFF300u;      // Common control       BSZ[1:0] = 2'b00: Serial Flash (1ch);  MD = 1: Manual mode
+      SFR32( RPC_CMNCR  ) = PAL_QSF_CMNCR(0x81FFF300u);      // Common control       BSZ[1:0] = PAL_QSF_CMNCR_BSZ;  MD = 1: Manual mode
       SFR32( RPC_SMCMR  ) = 0x00210000u;      // Manual mode command     CMD[7:0] = 8'h21 = 4SE: SubSector(4KB) Erase 4 byte addressing
-      SFR32( RPC_SMADR  ) = FlashAddr;        // Manual mode address      address
+      SFR32( RPC_SMADR  ) = PAL_QSF_DEV_ADDR(FlashAddr);        // Manual mode address      address
       SFR32( RPC_SMDRENR    ) = 0x00000000u;  // Manual mode DDR enable   HYPE = 3'b000: SPI Flash;  ADDRE = 0: address SDR transfer;  SPIDRE = 0: data SDR transfer
       SFR32( RPC_SMENR  ) = 0x00004F00u;      // Manual mode enable   CDB  [1:0] = 2'b00: 1-bit command (MOSI/MISO)
       //        ADB  [1:0] = 2'b00: 1-bit address (MOSI/MISO)
@@ -2288,9 +2757,9 @@ Std_ReturnType PAL_u_QsfProgramPage(uint32 FlashAddr, uint8 *RAMptr, uint32 Size
       break;
     }
     		// PRQA S 0303 5 //0303_SFR_32
-    SFR32( RPC_CMNCR  ) = 0x81FFF300u;        // Common control       BSZ[1:0] = 2'b00: Serial Flash (1ch);  MD = 1: Manual mode
+    SFR32( RPC_CMNCR  ) = PAL_QSF_CMNCR(0x81FFF300u);        // Common control       BSZ[1:0] = PAL_QSF_CMNCR_BSZ;  MD = 1: Manual mode
     SFR32( RPC_SMCMR  ) = 0x00120000u;        // Manual mode command     CMD[7:0] = 8'h12 = 4PP = Page program 4 byte addressing
-    SFR32( RPC_SMADR  ) = FlashAddr;          // Manual mode address      address
+    SFR32( RPC_SMADR  ) = PAL_QSF_DEV_ADDR(FlashAddr);          // Manual mode address      address
     SFR32( RPC_SMDRENR    ) = 0x00000000u;    // Manual mode DDR enable   HYPE = 3'b000: SPI Flash;  ADDRE = 0: address SDR transfer;  SPIDRE = 0: data SDR transfer
     SFR32( RPC_SMENR  ) = 0x00004F0Fu;        // Manual mode enable   CDB  [1:0] = 2'b00: 1-bit command (MOSI/MISO)
     //        ADB  [1:0] = 2'b00: 1-bit address (MOSI/MISO)
@@ -2364,7 +2833,14 @@ static void v_Qsf_DCacheRegionInvalidate(const uint32 u_Start, const uint32 u_Le
 
 uint32 PAL_u_QsfGetPageSize(void)
 {
-  return sPAL_Qsf.PageSize;
+  uint32 PageSize = sPAL_Qsf.PageSize;
+  // one program command is limited by the RPC write buffer, which is smaller than a striped page:
+  // in dual flash mode each device is programmed with half a device page per command (see PAL_QSF_DUAL_FLASH)
+  if ( PageSize > RPC_WRBUF_SIZE )
+  {
+    PageSize = RPC_WRBUF_SIZE;
+  }
+  return PageSize;
 }
 
 uint32 PAL_u_QsfGetSectorSize(void)
@@ -2400,12 +2876,14 @@ static void PAL_v_QsfDDRCalibration(void)
   uint32 u_TimeGetCount = SYS_TimeGetCount();
   if((0u == u_lastCalibrationTime_ticks) || ((u_TimeGetCount - u_lastCalibrationTime_ticks) > CALIBRATION_INTERVAL_TICKS))
   {
+    // the calibration reads send the command
+    v_Qsf_ExitContinuousRead();
     // PRQA S 0303 8 //0303_SFR_32
     /*** Initial setting External Address Space Read Mode ***/
     SFR32( RPC_DREAR    ) = 0x00000001u;
 
     SFR32( RPC_OFFSET1  ) = 0x21511144u;    // PHY timing offset        set PHY read mode to DDR
-    SFR32( RPC_CMNCR    ) = 0x01557300u;    // Common control       BSZ[1:0] = 2'b00: Serial Flash (1ch);  MD = 0: External address space mode
+    SFR32( RPC_CMNCR    ) = PAL_QSF_CMNCR(0x01557300u);    // Common control       BSZ[1:0] = PAL_QSF_CMNCR_BSZ;  MD = 0: External address space mode
     SFR32( RPC_DRCR     ) = 0x011F0200u;        // Data read control        RBE = 0: read bursts disabled
     SFR32( RPC_DRCMR    ) = 0x00EE0000u;    // Data read command        CMD[7:0] = 8'hEE = 4DDRQIOR = 4-byte address DDR Quad I/O Fast Read
     SFR32( RPC_DRENR    ) = 0x0222CF00u;
@@ -2498,6 +2976,7 @@ static void PAL_v_QsfDDRCalibration(void)
     u_calibratedStrtimValue = (u_strtimWindowsEnd + u_strtimWindowStart) >> 1u;  // get middle u_STRTIM tap position
 
     u_lastCalibrationTime_ticks = SYS_TimeGetCount();                           // get time of last calibration in ticks
+    b_ReadCacheDirty = TRUE;                                                    // read cache holds data of the tap scan
   }
   else
   {
@@ -85,7 +85,9 @@ typedef enum
   QSF_COMPARE,     ///< compare given RAM data with SDF data
   QSF_BLANKCHECK,  ///< check if area is erased
   QSF_OTP_READ,    ///< reading from OTP area in SDF
-  QSF_OTP_WRITE    ///< writing to OTP area in SDF
+  QSF_OTP_WRITE,   ///< writing to OTP area in SDF
+  QSF_CANCEL,      ///< waiting for the SDF after an aborted write/erase
+  QSF_CANCEL_INIT  ///< re-initialization of the SDF after the reset of an aborted write/erase
 } tQsfJob;
 
 /// Error codes for function returns
@@ -154,6 +156,8 @@ typedef struct
 Std_ReturnType PAL_u_QsfLockOTPArray(void);
 
 /// Start programming data to OTP area in flash.
+/// Any size is accepted, each OTP page is programmed with one page program command and the secured
+/// OTP area (Macronix) is entered and left only once per call.
 ///
 /// @pre                 initialized
 /// @post                Flash is busy until writing is finished
@@ -198,6 +202,8 @@ Std_ReturnType PAL_u_QsfLockOTPArray(void);
 Std_ReturnType PAL_u_QsfWriteOTPArray(uint8* p_data, uint32 size, uint32 addr);
 
 /// Start reading data from OTP area in flash.
+/// Any size is accepted, the range is read with one read command and the secured OTP area (Macronix)
+/// is entered and left only once per call.
 ///
 /// @pre                 initialized
 /// @post                Flash is busy until writing is finished
@@ -250,7 +256,10 @@ Std_ReturnType PAL_u_QsfReadOTPArray(uint8* read, uint32 size, uint32 addr);
 ///
 /// @InOutCorrelation    If the present SDF is properly detected and is supported then success (E_OK) is returned.
 ///                      The structure sPAL_Qsf is updated with values specific for the present SDF type.
-///                      Otherwise error code is returned.
+///                      Otherwise error code is returned. \n
+///                      After a successful initialization further calls with the same clock (e.g. a
+///                      partition switch) only update the sector size for the new partition
+///                      (see PAL_QSF_WARM_INIT and PAL_v_QsfForceColdInit).
 ///
 /// @callsequence
 /// @image html Call_sequence_for_PAL_u_QsfInit.png
@@ -298,6 +307,49 @@ Std_ReturnType PAL_u_QsfReadOTPArray(uint8* read, uint32 size, uint32 addr);
 ///               <a href="linkURL">doors://rbgs854a:40000/?version=2&prodID=0&urn=urn:telelogic::1-503e822e5ec3651e-O-524-0007caa0</a>
 Std_ReturnType PAL_u_QsfInit(const Fls_ConfigType* ConfigPtr);
 
+/// Forces a full initialization with the next call of PAL_u_QsfInit().
+///
+/// @pre                 none
+/// @post                Next PAL_u_QsfInit() resets the RPC module, probes the SDF and calibrates again.
+/// @param[in]           none
+/// @return              none
+///
+/// @globals             Clears the frequency of the last full initialization.
+///
+/// @InOutCorrelation    To be called when the RPC module or the SDF was reset or reconfigured by another master.
+void PAL_v_QsfForceColdInit(void);
+
+/// Aborts a running program or erase operation of the SDF with a software reset (0x66, 0x99).
+///
+/// @pre                 none
+/// @post                SDF returns to its power-on configuration and is busy until the reset is finished,
+///                      next PAL_u_QsfInit() performs a full initialization.
+/// @param[in]           none
+/// @return              PAL_QSF_OK if the reset is sent, PAL_QSF_ERROR_TIMEOUT if the transfer timed out
+///
+/// @globals             Clears the frequency of the last full initialization.
+///
+/// @InOutCorrelation    The aborted sector or page has undefined content. The commands are sent without
+///                      waiting for the SDF, use PAL_u_QsfIsBusy() to detect the end of the reset.
+Std_ReturnType PAL_u_QsfAbort(void);
+
+#ifndef PAL_QSF_BENCHMARK
+/// provide PAL_v_QsfReadBenchmark (STD_ON) or not (STD_OFF)
+#define PAL_QSF_BENCHMARK STD_OFF
+#endif
+
+#if (PAL_QSF_BENCHMARK == STD_ON)
+/// Measures the read throughput of the external address space.
+///
+/// @pre                 PAL_u_QsfInit() must be called successfully once, flash is idle.
+/// @post                RAMptr holds the read data.
+/// @param[in] FlashAddr: Address inside flash from where to read, the range must not cross the RPC window.
+/// @param[in] RAMptr: Location in RAM where to place the read data.
+/// @param[in] SizeBytes: Amount of bytes to read.
+/// @param[out] p_Result_us: [0] copy time with Qsf_memcpy, [1] copy time with the block copy, in us
+void PAL_v_QsfReadBenchmark(uint32 FlashAddr, uint8 *RAMptr, uint32 SizeBytes, uint32 *p_Result_us);
+#endif
+
 /// Low level read access to flash.
 ///
 /// @pre                 PAL_u_QsfInit() must be called successfully once.
@@ -639,7 +691,9 @@ Std_ReturnType PAL_u_QsfIsBusy( void );
 ///
 /// @globals             sPAL_Qsf
 ///
-/// @InOutCorrelation    returns sPAL_Qsf.PageSize
+/// @InOutCorrelation    returns sPAL_Qsf.PageSize, limited to the 256 byte RPC write buffer. In dual flash
+///                      mode the striped page is 512 bytes, so only half a device page is programmed per
+///                      command and the dual mode does not increase the write throughput.
 ///
 /// @callsequence
 ///
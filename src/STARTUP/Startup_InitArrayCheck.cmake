@@ -0,0 +1,24 @@
+#Post-link check of the constructor table (init array) of a linked image.
+#The check is done by check_init_array.py, see there for the script options.
+
+#script is installed next to this file, in the source tree it is in /scripts
+#cached, the function below is called from the directory of the image target
+if(EXISTS ${CMAKE_CURRENT_LIST_DIR}/check_init_array.py)
+    set(STARTUP_INIT_ARRAY_CHECK_SCRIPT ${CMAKE_CURRENT_LIST_DIR}/check_init_array.py CACHE INTERNAL "")
+else()
+    get_filename_component(STARTUP_INIT_ARRAY_CHECK_SCRIPT ${CMAKE_CURRENT_LIST_DIR}/../../scripts/check_init_array.py ABSOLUTE)
+    set(STARTUP_INIT_ARRAY_CHECK_SCRIPT ${STARTUP_INIT_ARRAY_CHECK_SCRIPT} CACHE INTERNAL "")
+endif()
+
+find_program(STARTUP_PYTHON NAMES python3 python)
+
+#STARTUP_add_init_array_check(<image target> [script options, e.g. --relative])
+#Runs the check as POST_BUILD step of the image target, the link fails if an entry is invalid.
+#Has to be called in the directory which creates the image target.
+function(STARTUP_add_init_array_check IMAGE_TARGET)
+    add_custom_command(TARGET ${IMAGE_TARGET} POST_BUILD
+        COMMAND ${STARTUP_PYTHON} ${STARTUP_INIT_ARRAY_CHECK_SCRIPT} $<TARGET_FILE:${IMAGE_TARGET}> ${ARGN}
+        COMMENT "Checking init array of ${IMAGE_TARGET}"
+        VERBATIM
+    )
+endfunction()
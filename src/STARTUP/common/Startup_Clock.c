@@ -0,0 +1,85 @@
+// Copyright (C) Continental AG
+// All Rights Reserved
+// COMPONENT: STARTUP_R7
+/// \file Startup_Clock.c
+/// \brief Table driven module clock enable
+
+#include <Startup_Clock.h>
+#include <sys_time.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Reads the register of a clock table entry with the configured access width.
+// PRQA S 0316 15
+// Msg(3:0316) [I] Cast from a pointer to void to a pointer to object type.
+// Reason: The table stores registers of different width, the width is given by u_Width.
+static uint32 u_ReadReg(volatile void* const p_Reg, const uint8 u_Width)
+{
+  uint32 u_Val;
+
+  if (u_Width == STARTUP_CLOCK_REG16)
+  {
+    u_Val = (uint32)(*((volatile uint16*)p_Reg));
+  }
+  else
+  {
+    u_Val = *((volatile uint32*)p_Reg);
+  }
+  return u_Val;
+}
+
+// PRQA S 0316 45
+// Msg(3:0316) [I] Cast from a pointer to void to a pointer to object type.
+// Reason: The table stores registers of different width, the width is given by u_Width.
+uint32 STARTUP_u_EnableClocks(const t_STARTUP_ClockEnable* p_Table, uint32 u_Count, uint32 u_Timeout)
+{
+  uint32 u_Pending = 0u;
+  uint32 u_Idx;
+  uint32 u_Start;
+  const uint32 u_Num = (u_Count > STARTUP_CLOCK_MAX_ENTRIES) ? STARTUP_CLOCK_MAX_ENTRIES : u_Count;
+  const t_STARTUP_ClockEnable* p_Entry;
+
+  // issue all module stop clear writes back to back
+  for (u_Idx = 0u; u_Idx < u_Num; u_Idx++)
+  {
+    p_Entry = &p_Table[u_Idx];
+    if (p_Entry->u_Width == STARTUP_CLOCK_REG16)
+    {
+      *((volatile uint16*)p_Entry->p_Ctrl) &= (uint16)~p_Entry->u_Mask;
+    }
+    else
+    {
+      *((volatile uint32*)p_Entry->p_Ctrl) &= ~p_Entry->u_Mask;
+    }
+    u_Pending |= (1uL << u_Idx);
+  }
+
+  // wait once for all modules with a common timeout
+  u_Start = SYS_TimeGetCount();
+  while (u_Pending != 0u)
+  {
+    for (u_Idx = 0u; u_Idx < u_Num; u_Idx++)
+    {
+      p_Entry = &p_Table[u_Idx];
+      if ( ((u_Pending & (1uL << u_Idx)) != 0u) &&
+           ((u_ReadReg(p_Entry->p_Status, p_Entry->u_Width) & p_Entry->u_Mask) == 0u) )
+      {
+        u_Pending &= ~(1uL << u_Idx);
+      }
+    }
+
+    if (SYS_TimeGetSince(u_Start) >= u_Timeout)
+    {
+      break;
+    }
+  }
+
+  return u_Pending;
+}
+
+#ifdef __cplusplus
+}
+#endif
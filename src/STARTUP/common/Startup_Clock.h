@@ -0,0 +1,49 @@
+// Copyright (C) Continental AG
+// All Rights Reserved
+// COMPONENT: STARTUP_R7
+/// \file Startup_Clock.h
+/// \brief Table driven module clock enable
+
+#ifndef STARTUP_CLOCK_H
+#define STARTUP_CLOCK_H
+
+#include <Std_Types.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Maximum number of entries of one clock table (one bit per entry in the result).
+#define STARTUP_CLOCK_MAX_ENTRIES  (32u)
+
+/// Access width of the control and status register of a clock table entry.
+#define STARTUP_CLOCK_REG32        (0u)
+#define STARTUP_CLOCK_REG16        (1u)
+
+/// One module clock: the bits in u_Mask are cleared in the control register (module stop clear)
+/// and the clock is running when the same bits read as zero in the status register.
+typedef struct
+{
+  volatile void* p_Ctrl;     ///< control register
+  volatile void* p_Status;   ///< status register
+  uint32 u_Mask;             ///< stop bits of the module
+  uint8  u_Width;            ///< STARTUP_CLOCK_REG32 or STARTUP_CLOCK_REG16
+} t_STARTUP_ClockEnable;
+
+/// Enables all module clocks of a table. \n
+/// All stop bits are cleared first, then the status of all entries is polled together
+/// with one common timeout.
+/// @pre      System timer is running.
+/// @post     Module clocks are running unless reported as failed.
+/// @param    p_Table     clock table
+/// @param    u_Count     number of entries, at most STARTUP_CLOCK_MAX_ENTRIES
+/// @param    u_Timeout   timeout in SYS_TimeGetCount() ticks
+/// @return   0 on success, otherwise bit n set for every table entry n which did not start
+uint32 STARTUP_u_EnableClocks(const t_STARTUP_ClockEnable* p_Table, uint32 u_Count, uint32 u_Timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // #ifndef STARTUP_CLOCK_H
@@ -0,0 +1,93 @@
+// Copyright (C) Continental AG
+// All Rights Reserved
+// COMPONENT: STARTUP_R7
+/// \file Startup_Ctors.c
+/// \brief Common runner for the constructors of static C++ objects
+
+#include <Startup_Ctors.h>
+
+#if (STARTUP_CTOR_TIMING == STD_ON)
+/// Time stamp used for the constructor timing, defaults to the system timer.
+#ifndef STARTUP_CTOR_TIMESTAMP
+#include <sys_time.h>
+#define STARTUP_CTOR_TIMESTAMP()   SYS_TimeGetCount()
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Constructor function pointer type
+typedef void (*t_STARTUP_Ctor)(void); //PRQA S 5004
+
+#if (STARTUP_CTOR_TIMING == STD_ON)
+uint32 STARTUP_au_CtorTime[STARTUP_CTOR_TIMING_MAX];
+uint32 STARTUP_u_CtorTotalTime;
+#endif
+
+// PRQA S 0305,0307,0488 45
+// Msg(3:0305) [I] Cast between a pointer to function and an integral type.
+// Msg(3:0307) [u] Cast between a pointer to object and a pointer to function.
+// Msg(4:0488) Performing pointer arithmetic.
+// Reason: Constructor pointer must be calculated from the linker generated table.
+void STARTUP_v_RunCtors(const void* p_First, uint32 u_Count, uint8 u_Format, t_STARTUP_CtorError p_OnNull)
+{
+  const sint32* p_Rel = (const sint32*)p_First;
+  t_STARTUP_Ctor const* p_Abs = (t_STARTUP_Ctor const*)p_First;
+  t_STARTUP_Ctor ctor;
+  uint32 u_Idx;
+#if (STARTUP_CTOR_TIMING == STD_ON)
+  uint32 u_Start;
+  const uint32 u_First = STARTUP_CTOR_TIMESTAMP();
+#endif
+
+#if (STARTUP_CTOR_CHECK_NULL == STD_OFF)
+  (void)p_OnNull;
+#endif
+
+  for (u_Idx = 0u; u_Idx < u_Count; u_Idx++)
+  {
+    if (u_Format == STARTUP_CTOR_RELATIVE)
+    {
+      ctor = (t_STARTUP_Ctor)((const uint8*)&p_Rel[u_Idx] + p_Rel[u_Idx]);
+    }
+    else
+    {
+      ctor = p_Abs[u_Idx];
+    }
+
+#if (STARTUP_CTOR_CHECK_NULL == STD_ON)
+    if ((ctor == NULL) || ((u_Format == STARTUP_CTOR_RELATIVE) && (p_Rel[u_Idx] == 0)))
+    {
+      // Report error...init array entry is NULL pointer
+      if (p_OnNull != NULL)
+      {
+        p_OnNull(u_Idx);
+      }
+    }
+    else
+#endif
+    {
+#if (STARTUP_CTOR_TIMING == STD_ON)
+      u_Start = STARTUP_CTOR_TIMESTAMP();
+      (ctor)();
+      if (u_Idx < STARTUP_CTOR_TIMING_MAX)
+      {
+        STARTUP_au_CtorTime[u_Idx] = STARTUP_CTOR_TIMESTAMP() - u_Start;
+      }
+#else
+      (ctor)();
+#endif
+    }
+  }
+
+#if (STARTUP_CTOR_TIMING == STD_ON)
+  STARTUP_u_CtorTotalTime = STARTUP_CTOR_TIMESTAMP() - u_First;
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
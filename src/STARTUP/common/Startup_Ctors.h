@@ -0,0 +1,67 @@
+// Copyright (C) Continental AG
+// All Rights Reserved
+// COMPONENT: STARTUP_R7
+/// \file Startup_Ctors.h
+/// \brief Common runner for the constructors of static C++ objects
+///
+/// The init array can be validated after linking with scripts/check_init_array.py,
+/// which reports NULL entries and entries pointing outside of the code sections.
+/// With a validated image the runtime NULL check can be disabled (STARTUP_CTOR_CHECK_NULL).
+
+#ifndef STARTUP_CTORS_H
+#define STARTUP_CTORS_H
+
+#include <Std_Types.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Init array entries are absolute constructor addresses (TI linker).
+#define STARTUP_CTOR_ABSOLUTE      (0u)
+
+/// Init array entries are signed offsets relative to the entry itself (ARM linker SHT$$INIT_ARRAY).
+#define STARTUP_CTOR_RELATIVE      (1u)
+
+/// Check every init array entry for NULL at runtime (STD_ON) or rely on the post link check (STD_OFF).
+#ifndef STARTUP_CTOR_CHECK_NULL
+#define STARTUP_CTOR_CHECK_NULL    STD_ON
+#endif
+
+/// Measure the duration of every constructor (STD_ON) in STARTUP_CTOR_TIMESTAMP() ticks.
+#ifndef STARTUP_CTOR_TIMING
+#define STARTUP_CTOR_TIMING        STD_OFF
+#endif
+
+/// Number of constructors whose duration is recorded in STARTUP_au_CtorTime.
+#ifndef STARTUP_CTOR_TIMING_MAX
+#define STARTUP_CTOR_TIMING_MAX    (64u)
+#endif
+
+/// Reaction on a NULL init array entry, u_Index is the position in the init array.
+typedef void (*t_STARTUP_CtorError)(uint32 u_Index); //PRQA S 5004
+
+#if (STARTUP_CTOR_TIMING == STD_ON)
+/// Duration of constructor n of the last STARTUP_v_RunCtors() call.
+extern uint32 STARTUP_au_CtorTime[STARTUP_CTOR_TIMING_MAX];
+
+/// Duration of all constructors of the last STARTUP_v_RunCtors() call.
+extern uint32 STARTUP_u_CtorTotalTime;
+#endif
+
+/// Calls the constructors of an init array in table order.
+/// @pre      Data and BSS are initialized.
+/// @post     Static objects are constructed.
+/// @param    p_First    first init array entry to be called
+/// @param    u_Count    number of entries
+/// @param    u_Format   STARTUP_CTOR_ABSOLUTE or STARTUP_CTOR_RELATIVE
+/// @param    p_OnNull   called for a NULL entry (only with STARTUP_CTOR_CHECK_NULL), NULL skips the entry
+/// @return   none
+void STARTUP_v_RunCtors(const void* p_First, uint32 u_Count, uint8 u_Format, t_STARTUP_CtorError p_OnNull);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // #ifndef STARTUP_CTORS_H
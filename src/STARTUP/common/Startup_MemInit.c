@@ -0,0 +1,163 @@
+// Copyright (C) Continental AG
+// All Rights Reserved
+// COMPONENT: STARTUP
+/// \file Startup_MemInit.c
+/// \brief Table driven memory init shared by the startup variants.
+///        The burst kernels STARTUP_v_ZeroInit()/STARTUP_v_CopyInit() come from
+///        Startup_MemInit.S if STARTUP_MEMINIT_ASM is defined, otherwise the portable
+///        C kernels below are used (e.g. for host builds).
+
+#include <stddef.h>
+#include "Startup_MemInit.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Platform hook for large regions, e.g. DMA based init. Evaluates to TRUE if the
+/// region was initialized by the hook. Default: all regions are initialized by the CPU.
+#ifndef STARTUP_MEMINIT_REGION_HOOK
+#define STARTUP_MEMINIT_REGION_HOOK(p_Region) (FALSE)
+#endif
+
+/// Regions smaller than this are always initialized by the CPU.
+#ifndef STARTUP_MEMINIT_HOOK_MIN_LEN
+#define STARTUP_MEMINIT_HOOK_MIN_LEN (0x4000u)
+#endif
+
+/// Number of words written per iteration of the C kernels.
+#define STARTUP_MEMINIT_BURST_WORDS (8u)
+
+#define STARTUP_START_SEC_CODE_ASIL_B
+#include "Startup_Memmap.h"
+#undef STARTUP_MEMMAP_H
+
+void STARTUP_v_InitRegions(const t_STARTUP_MemRegion* p_Regions, uint32 u_Count)
+{
+  uint32 u_Idx;
+  uint32 u_Len;
+
+  for (u_Idx = 0u; u_Idx < u_Count; u_Idx++)
+  {
+    u_Len = (uint32)((const uint8*)p_Regions[u_Idx].p_End - (const uint8*)p_Regions[u_Idx].p_Start);
+
+    if ((u_Len >= STARTUP_MEMINIT_HOOK_MIN_LEN) && (FALSE != STARTUP_MEMINIT_REGION_HOOK(&p_Regions[u_Idx])))
+    {
+      // region initialized by the platform
+    }
+    else if (NULL == p_Regions[u_Idx].p_Init)
+    {
+      STARTUP_v_ZeroInit(p_Regions[u_Idx].p_Start, p_Regions[u_Idx].p_End);
+    }
+    else
+    {
+      STARTUP_v_CopyInit(p_Regions[u_Idx].p_Start, p_Regions[u_Idx].p_End, p_Regions[u_Idx].p_Init);
+    }
+  }
+}
+
+#ifndef STARTUP_MEMINIT_ASM
+// PRQA S 0306,0488,0489 ++
+// Reason: address arithmetic on linker provided memory areas.
+void STARTUP_v_ZeroInit(void* p_Start, const void* p_End)
+{
+  volatile uint8*  p_Byte = (volatile uint8*)p_Start;
+  volatile uint32* p_Word;
+  uint32           u_Len  = (uint32)((const uint8*)p_End - (const uint8*)p_Start);
+  uint32           u_Idx;
+
+  while ((u_Len != 0u) && (((size_t)p_Byte & 3u) != 0u))
+  {
+    *p_Byte = 0u;
+    p_Byte++;
+    u_Len--;
+  }
+
+  p_Word = (volatile uint32*)p_Byte;
+  while (u_Len >= (STARTUP_MEMINIT_BURST_WORDS * 4u))
+  {
+    for (u_Idx = 0u; u_Idx < STARTUP_MEMINIT_BURST_WORDS; u_Idx++)
+    {
+      p_Word[u_Idx] = 0u;
+    }
+    p_Word += STARTUP_MEMINIT_BURST_WORDS;
+    u_Len  -= STARTUP_MEMINIT_BURST_WORDS * 4u;
+  }
+  while (u_Len >= 4u)
+  {
+    *p_Word = 0u;
+    p_Word++;
+    u_Len -= 4u;
+  }
+
+  p_Byte = (volatile uint8*)p_Word;
+  while (u_Len != 0u)
+  {
+    *p_Byte = 0u;
+    p_Byte++;
+    u_Len--;
+  }
+}
+
+void STARTUP_v_CopyInit(void* p_Start, const void* p_End, const void* p_Init)
+{
+  volatile uint8*  p_Byte    = (volatile uint8*)p_Start;
+  const uint8*     p_SrcByte = (const uint8*)p_Init;
+  volatile uint32* p_Word;
+  const uint32*    p_SrcWord;
+  uint32           u_Len     = (uint32)((const uint8*)p_End - (const uint8*)p_Start);
+  uint32           u_Idx;
+
+  if (((size_t)p_Byte & 3u) == ((size_t)p_SrcByte & 3u))
+  {
+    while ((u_Len != 0u) && (((size_t)p_Byte & 3u) != 0u))
+    {
+      *p_Byte = *p_SrcByte;
+      p_Byte++;
+      p_SrcByte++;
+      u_Len--;
+    }
+
+    p_Word    = (volatile uint32*)p_Byte;
+    p_SrcWord = (const uint32*)p_SrcByte;
+    while (u_Len >= (STARTUP_MEMINIT_BURST_WORDS * 4u))
+    {
+      for (u_Idx = 0u; u_Idx < STARTUP_MEMINIT_BURST_WORDS; u_Idx++)
+      {
+        p_Word[u_Idx] = p_SrcWord[u_Idx];
+      }
+      p_Word    += STARTUP_MEMINIT_BURST_WORDS;
+      p_SrcWord += STARTUP_MEMINIT_BURST_WORDS;
+      u_Len     -= STARTUP_MEMINIT_BURST_WORDS * 4u;
+    }
+    while (u_Len >= 4u)
+    {
+      *p_Word = *p_SrcWord;
+      p_Word++;
+      p_SrcWord++;
+      u_Len -= 4u;
+    }
+
+    p_Byte    = (volatile uint8*)p_Word;
+    p_SrcByte = (const uint8*)p_SrcWord;
+  }
+
+  while (u_Len != 0u)
+  {
+    *p_Byte = *p_SrcByte;
+    p_Byte++;
+    p_SrcByte++;
+    u_Len--;
+  }
+}
+// PRQA S 0306,0488,0489 --
+#endif // STARTUP_MEMINIT_ASM
+
+#define STARTUP_STOP_SEC_CODE_ASIL_B
+#include "Startup_Memmap.h"
+#undef STARTUP_MEMMAP_H
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,60 @@
+// Copyright (C) Continental AG
+// All Rights Reserved
+// COMPONENT: STARTUP
+/// \file Startup_MemInit.h
+/// \brief Table driven memory init shared by the startup variants
+
+#ifndef STARTUP_MEMINIT_H
+#define STARTUP_MEMINIT_H
+
+#include <Std_Types.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// RAM region initialized by STARTUP_v_InitRegions().
+typedef struct
+{
+  void*       p_Start;    ///< first byte of the RAM region
+  const void* p_End;      ///< first byte after the RAM region
+  const void* p_Init;     ///< init image of the region, NULL for zero init
+} t_STARTUP_MemRegion;
+
+/// @brief    Initializes all regions of a table in order. Each region is either zeroed or
+///           loaded from its init image. Regions of at least STARTUP_MEMINIT_HOOK_MIN_LEN
+///           bytes are first offered to the platform hook STARTUP_MEMINIT_REGION_HOOK (e.g. DMA).
+/// @pre      Stack is available, the regions do not contain the stack.
+/// @post     All regions are initialized.
+/// @param    p_Regions  region table, usually built from linker symbols
+/// @param    u_Count    number of entries in p_Regions
+/// @return   none
+void STARTUP_v_InitRegions(const t_STARTUP_MemRegion* p_Regions, uint32 u_Count);
+
+/// @brief    Clears the memory area [p_Start, p_End) using 32 byte multi-register stores
+///           for the aligned part of the area. Start and end do not need to be aligned.
+///           The ARM kernel saves r4-r9 on the stack, they are returned as zero if the stack
+///           lies inside the area.
+/// @pre      Stack is available.
+/// @post     memory area is zero
+/// @param    p_Start   first byte of the area
+/// @param    p_End     first byte after the area
+/// @return   none
+void STARTUP_v_ZeroInit(void* p_Start, const void* p_End);
+
+/// @brief    Copies the init image p_Init to the memory area [p_Start, p_End) using 32 byte
+///           multi-register loads and stores where the alignment of both areas allows it.
+/// @pre      Areas do not overlap.
+/// @post     memory area holds the init image
+/// @param    p_Start   first byte of the area
+/// @param    p_End     first byte after the area
+/// @param    p_Init    first byte of the init image
+/// @return   none
+void STARTUP_v_CopyInit(void* p_Start, const void* p_End, const void* p_Init);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // #ifndef STARTUP_MEMINIT_H
@@ -0,0 +1,79 @@
+// Copyright (C) Continental AG
+// All Rights Reserved
+// COMPONENT: STARTUP_R7
+/// \file Startup_Ppar.h
+/// \brief Background copy of the PPAR block from serial flash into SRAM
+
+#ifndef STARTUP_PPAR_H
+#define STARTUP_PPAR_H
+
+#include <Std_Types.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Keep a full SRAM copy of the PPAR block in .ppar_bu (STD_ON) or read PPAR records
+/// on demand from serial flash (STD_OFF). Consumers accessing .ppar_bu directly require STD_ON.
+#ifndef STARTUP_PPAR_FULL_COPY
+#define STARTUP_PPAR_FULL_COPY STD_ON
+#endif
+
+/// Consumers reading the .ppar_bu section directly are linked (STD_ON) or all PPAR consumers
+/// use STARTUP_u_ReadPPAR() (STD_OFF). The on-demand read requires STD_OFF.
+#ifndef STARTUP_PPAR_SRAM_CONSUMERS
+#define STARTUP_PPAR_SRAM_CONSUMERS STD_ON
+#endif
+
+#if (STARTUP_PPAR_FULL_COPY == STD_OFF)
+#if defined(CYBERSEC_ENABLED)
+#error "STARTUP_PPAR_FULL_COPY == STD_OFF skips the PPAR authentication of Load_xpar(), not allowed with CYBERSEC_ENABLED"
+#endif
+#if (STARTUP_PPAR_SRAM_CONSUMERS == STD_ON)
+#error "STARTUP_PPAR_FULL_COPY == STD_OFF leaves .ppar_bu empty, consumers have to use STARTUP_u_ReadPPAR()"
+#endif
+#endif
+
+/// Starts the copy of the PPAR block from serial flash into the .ppar_bu section. \n
+/// The function only initializes the flash driver and queues the read job, it returns
+/// before the data is available. Calling it again after the copy was started has no effect.
+/// @pre      Global data is initialized, the system timer is running and the SDF lock is held.
+/// @post     PPAR read job is pending in the flash driver.
+/// @return   none
+void STARTUP_v_StartPPARCopy(void);
+
+/// Advances a pending PPAR copy by one step of the flash driver. \n
+/// Intended to be called between other init steps and from loops doing other work, e.g. the
+/// boot stage loop, so the copy progresses while that work is running or waiting.
+/// @pre      none
+/// @post     none
+/// @return   TRUE when the PPAR copy is finished, FALSE otherwise
+boolean STARTUP_b_PollPPARCopy(void);
+
+/// Barrier for the PPAR copy. \n
+/// Starts the copy if not done yet and blocks until the PPAR data is available in SRAM.
+/// Must be called before PPAR is consumed and before the flash driver is handed over.
+/// @pre      Global data is initialized, the system timer is running and the SDF lock is held.
+/// @post     PPAR data is available in the .ppar_bu section.
+/// @return   none
+void STARTUP_v_WaitPPARCopy(void);
+
+/// Reads a range of the PPAR block. \n
+/// With STARTUP_PPAR_FULL_COPY the data is taken from the SRAM copy (waiting for the copy if
+/// needed), otherwise it is read on demand from serial flash through a small line cache. A line
+/// is read as partition job of the flash driver, so it is scheduled with the jobs of NvM.
+/// @pre      STARTUP_v_StartPPARCopy() was called. The on-demand read must not be called from a
+///           context preempting Fls_MainFunction(), it waits for its job at most STARTUP_PPAR_READ_TIMEOUT.
+/// @post     none
+/// @param    u_Offset  offset inside the PPAR block
+/// @param    p_Dest    destination buffer
+/// @param    u_Len     number of bytes to read
+/// @return   E_OK on success, E_NOT_OK on invalid range or flash access error
+Std_ReturnType STARTUP_u_ReadPPAR(uint32 u_Offset, uint8* p_Dest, uint32 u_Len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // #ifndef STARTUP_PPAR_H
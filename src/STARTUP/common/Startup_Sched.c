@@ -0,0 +1,77 @@
+// Copyright (C) Continental AG
+// All Rights Reserved
+// COMPONENT: STARTUP_R7
+/// \file Startup_Sched.c
+/// \brief Cooperative scheduler for boot stages with dependencies
+
+#include <Startup_Sched.h>
+#include <sys_time.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+uint32 STARTUP_u_RunStages(const t_STARTUP_Stage* p_Stages, t_STARTUP_StageKpi* p_Kpi, uint32 u_Count)
+{
+  const uint32 u_Num = (u_Count > STARTUP_STAGE_MAX) ? STARTUP_STAGE_MAX : u_Count;
+  uint32 u_Open = 0u;      // stages not finished
+  uint32 u_Done = 0u;      // stages finished successfully
+  uint32 u_Idx;
+  uint32 u_Bit;
+  uint8  u_State;
+
+  for (u_Idx = 0u; u_Idx < u_Num; u_Idx++)
+  {
+    p_Kpi[u_Idx].u_Start = 0u;
+    p_Kpi[u_Idx].u_End   = 0u;
+    p_Kpi[u_Idx].u_State = STARTUP_STAGE_WAITING;
+    u_Open |= (1uL << u_Idx);
+  }
+
+  while (u_Open != 0u)
+  {
+    for (u_Idx = 0u; u_Idx < u_Num; u_Idx++)
+    {
+      u_Bit = 1uL << u_Idx;
+      if ((u_Open & u_Bit) != 0u)
+      {
+        if ((p_Stages[u_Idx].u_Depends & ~(u_Done | u_Open)) != 0u)
+        {
+          // a dependency finished without success
+          p_Kpi[u_Idx].u_State = STARTUP_STAGE_SKIPPED;
+          u_Open &= ~u_Bit;
+        }
+        else if ((p_Stages[u_Idx].u_Depends & ~u_Done) == 0u)
+        {
+          if (p_Kpi[u_Idx].u_State == STARTUP_STAGE_WAITING)
+          {
+            p_Kpi[u_Idx].u_Start = SYS_TimeGetCount();
+          }
+
+          u_State = p_Stages[u_Idx].p_Step();
+          p_Kpi[u_Idx].u_State = u_State;
+          if (u_State != STARTUP_STAGE_BUSY)
+          {
+            p_Kpi[u_Idx].u_End = SYS_TimeGetCount();
+            u_Open &= ~u_Bit;
+            if (u_State == STARTUP_STAGE_DONE)
+            {
+              u_Done |= u_Bit;
+            }
+          }
+        }
+        else
+        {
+          // dependencies still running
+        }
+      }
+    }
+  }
+
+  return (u_Num == STARTUP_STAGE_MAX) ? ~u_Done : (((1uL << u_Num) - 1u) & ~u_Done);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,70 @@
+// Copyright (C) Continental AG
+// All Rights Reserved
+// COMPONENT: STARTUP_R7
+/// \file Startup_Sched.h
+/// \brief Cooperative scheduler for boot stages with dependencies
+
+#ifndef STARTUP_SCHED_H
+#define STARTUP_SCHED_H
+
+#include <Std_Types.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Maximum number of stages of one stage table (one bit per stage in the dependency masks).
+#define STARTUP_STAGE_MAX          (32u)
+
+/// Stage was not called yet.
+#define STARTUP_STAGE_WAITING      (0u)
+
+/// Stage is running, the step function has to be called again.
+#define STARTUP_STAGE_BUSY         (1u)
+
+/// Stage finished successfully.
+#define STARTUP_STAGE_DONE         (2u)
+
+/// Stage failed.
+#define STARTUP_STAGE_FAILED       (3u)
+
+/// Stage was not run because a dependency failed.
+#define STARTUP_STAGE_SKIPPED      (4u)
+
+/// Step function of a boot stage. \n
+/// Performs a bounded amount of work and returns STARTUP_STAGE_BUSY, _DONE or _FAILED.
+typedef uint8 (*t_STARTUP_StageStep)(void); //PRQA S 5004
+
+/// Boot stage: step function and mask of the stages (bit n = stage n) which must be done before.
+typedef struct
+{
+  t_STARTUP_StageStep p_Step;     ///< step function
+  uint32              u_Depends;  ///< dependency mask
+} t_STARTUP_Stage;
+
+/// KPI record of a boot stage in SYS_TimeGetCount() ticks.
+typedef struct
+{
+  uint32 u_Start;   ///< time of the first call of the step function
+  uint32 u_End;     ///< time when the stage finished
+  uint8  u_State;   ///< STARTUP_STAGE_xxx
+} t_STARTUP_StageKpi;
+
+/// Runs a table of boot stages. \n
+/// Every stage whose dependencies are done is stepped in a round robin loop, so independent
+/// stages interleave. A stage depending on a failed or skipped stage is skipped.
+/// The function returns when all stages are finished.
+/// @pre      System timer is running, dependencies only refer to existing stages.
+/// @post     p_Kpi holds state and timing of every stage.
+/// @param    p_Stages   stage table
+/// @param    p_Kpi      KPI record per stage
+/// @param    u_Count    number of stages, at most STARTUP_STAGE_MAX
+/// @return   0 if all stages are done, otherwise bit n set for every stage n not done
+uint32 STARTUP_u_RunStages(const t_STARTUP_Stage* p_Stages, t_STARTUP_StageKpi* p_Kpi, uint32 u_Count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // #ifndef STARTUP_SCHED_H
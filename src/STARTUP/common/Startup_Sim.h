@@ -0,0 +1,44 @@
+// Copyright (C) Continental AG
+// All Rights Reserved
+// COMPONENT: STARTUP
+/// \file Startup_Sim.h
+/// \brief Register access hooks for host builds of the startup code
+///
+/// With STARTUP_SIM_REG_ACCESS defined (host builds only, together with __GTEST_SWITCH__ or
+/// __UNIT_TEST_SWITCH__) the direct register accesses of the TI and M4 startup code are
+/// forwarded to these functions. A host harness provides them to simulate register blocks,
+/// model access latencies and count register accesses (tests/STARTUP does so for the M4 startup).
+/// The R7 startup code and IuSbl use the __COURAGE_TEST_SWITCH__ register macros instead.
+
+#ifndef STARTUP_SIM_H
+#define STARTUP_SIM_H
+
+#include <Std_Types.h>
+#ifdef STARTUP_SIM_REG_ACCESS
+#include <stdint.h>
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef STARTUP_SIM_REG_ACCESS
+/// Simulated 32 bit register write.
+void STARTUP_v_SimWrite32(uint32 u_Addr, uint32 u_Value);
+
+/// Simulated 8 bit register write.
+void STARTUP_v_SimWrite8(uint32 u_Addr, uint8 u_Value);
+
+/// Simulated 32 bit register read.
+uint32 STARTUP_u_SimRead32(uint32 u_Addr);
+
+/// Simulated write of the core register BASEPRI, returns the value read back afterwards.
+uint8 STARTUP_u_SimSetBasepri(uint8 u_Value);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // #ifndef STARTUP_SIM_H
@@ -0,0 +1,78 @@
+// Copyright (C) Continental AG
+// All Rights Reserved
+// COMPONENT: STARTUP_R7
+/// \file Startup_StackFill.h
+/// \brief Configuration of the kernel stack pattern fill (used by C and assembler code)
+
+#ifndef STARTUP_STACKFILL_H
+#define STARTUP_STACKFILL_H
+
+/// Pattern used for stack watermarking.
+#define STARTUP_STACK_PATTERN       0xEBEBEBEB
+
+/// Fill the complete kernel stack at boot (0) or only the guard band at the stack limit
+/// and the rest later via STARTUP_b_FillStackDeferred() (1).
+#ifndef STARTUP_STACK_FILL_DEFERRED
+#define STARTUP_STACK_FILL_DEFERRED 0
+#endif
+
+/// Size of the guard band at the stack limit filled at boot in deferred mode, multiple of 32.
+#ifndef STARTUP_STACK_GUARD_LEN
+#define STARTUP_STACK_GUARD_LEN     0x400
+#endif
+
+/// Number of bytes filled per call of STARTUP_b_FillStackDeferred(), multiple of 32.
+#ifndef STARTUP_STACK_FILL_CHUNK
+#define STARTUP_STACK_FILL_CHUNK    0x200
+#endif
+
+#if ((STARTUP_STACK_GUARD_LEN % 32) != 0) || ((STARTUP_STACK_FILL_CHUNK % 32) != 0)
+#error "STARTUP_STACK_GUARD_LEN and STARTUP_STACK_FILL_CHUNK have to be multiples of 32"
+#endif
+
+#if (STARTUP_STACK_FILL_DEFERRED == 1)
+/// Size of the smallest kernel stack painted by the startup code, has to match the OS configuration.
+/// Required in deferred mode, the guard band fill at boot must not run past the stack.
+#ifndef STARTUP_KERNEL_STACK_SIZE
+#error "STARTUP_KERNEL_STACK_SIZE has to be defined when STARTUP_STACK_FILL_DEFERRED is 1"
+#elif (STARTUP_KERNEL_STACK_SIZE <= STARTUP_STACK_GUARD_LEN)
+#error "STARTUP_STACK_GUARD_LEN has to be smaller than every kernel stack (STARTUP_KERNEL_STACK_SIZE)"
+#endif
+#endif
+
+#ifndef __ASSEMBLER__
+#include <Std_Types.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Lock used around one chunk of the deferred fill. The kernel stack must not be in use
+/// while a chunk is painted, i.e. interrupts have to be locked by the integrator.
+#ifndef STARTUP_STACK_FILL_LOCK
+#define STARTUP_STACK_FILL_LOCK()
+#endif
+#ifndef STARTUP_STACK_FILL_UNLOCK
+#define STARTUP_STACK_FILL_UNLOCK()
+#endif
+
+/// Paints the next chunk of the kernel stack above the guard band with the watermark pattern. \n
+/// Intended to be called cyclically when STARTUP_STACK_FILL_DEFERRED is 1. The kernel stack is
+/// only writable in a privileged mode, an unprivileged idle task has to call it through an OS
+/// trusted function (or a privileged idle hook). Called in user mode nothing is painted.
+/// @pre      Called in a privileged mode from task level, the kernel stack is not in use.
+/// @post     none
+/// @return   TRUE when the complete kernel stack is painted, FALSE otherwise
+boolean STARTUP_b_FillStackDeferred(void);
+
+/// @brief    Checks the processor mode of the caller (startup assembler code).
+/// @return   TRUE in any privileged mode, FALSE in user mode
+boolean STARTUP_b_IsPrivileged(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // __ASSEMBLER__
+
+#endif // #ifndef STARTUP_STACKFILL_H
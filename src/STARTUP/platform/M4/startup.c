@@ -9,6 +9,8 @@
 #include "Std_Types.h"
 #include "startup_cfg.h"
 #include "startup.h"
+#include "Startup_MemInit.h"
+#include "Startup_Sim.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -200,18 +202,10 @@ void STARTUP_v_PreMainStartup(void)
 static void STARTUP_v_MemoryZeroInit(const MemArea *memAreaSet)
 {
   uint32    ui32_i;
-  volatile uint32 *memPtrStart;
-  volatile uint32 *memPtrEnd;
 
   for (ui32_i=0; ui32_i<ZERO_INIT_GROUPS_COUNT; ui32_i++)
   {
-    memPtrStart = get_pui32PtrToReg(memAreaSet[ui32_i].Start);
-    memPtrEnd = get_pui32PtrToReg(memAreaSet[ui32_i].End);
-    while (memPtrStart < memPtrEnd)
-    {
-      *memPtrStart = 0u;
-      memPtrStart++;
-    }
+    STARTUP_v_ZeroInit(get_pui32PtrToReg(memAreaSet[ui32_i].Start), get_pui32PtrToReg(memAreaSet[ui32_i].End));
   }
 }
 #endif
@@ -237,12 +231,7 @@ static void STARTUP_v_MemoryInit(const RamMemArea *memAreasSet)
       STARTUP_v_ExceptionHandler();
     }
 
-    while (memPtrStart < memPtrEnd)
-    {
-      *memPtrStart = *romPtrStart;
-      memPtrStart++;
-      romPtrStart++;
-    }
+    STARTUP_v_CopyInit(memPtrStart, memPtrEnd, romPtrStart);
   }
 }
 #endif
@@ -257,6 +246,9 @@ static void STARTUP_v_HwDisableInterruptAtPowerOn(void)
 
   DisIntITmp = 0u; // prevent compiler warning
 
+#ifdef STARTUP_SIM_REG_ACCESS
+  DisIntITmp = STARTUP_u_SimSetBasepri(255u);
+#else
   /* get pointer to DisIntITmp */
   // PRQA S 3462 1 # date: 2024-01-16, reviewer: uidg9094, CCBIssueId: ADASQMS-3493, reason: common usage in embedded development
   __as1(LDR  R4, =DisIntITmp)
@@ -268,6 +260,7 @@ static void STARTUP_v_HwDisableInterruptAtPowerOn(void)
   // DisIntITmp = BASEPRI
   __as1(MRS  R2, basepri)
   __as1(STRB R2, [R4])
+#endif
 
   DisIntPrioTmp = 0XFFU;
   for (ui8_Idx = 0; ui8_Idx < 8u; ui8_Idx++)
@@ -287,12 +280,16 @@ static void STARTUP_v_HwDisableInterruptAtPowerOn(void)
     }
   }
 
+#ifdef STARTUP_SIM_REG_ACCESS
+  (void)STARTUP_u_SimSetBasepri(DisIntPrioTmp);
+#else
   // get pointer to DisIntPrioTmp
   // PRQA S 3462 1 # date: 2024-01-16, reviewer: uidg9094, CCBIssueId: ADASQMS-3493, reason: common usage in embedded development
   __as1(LDR  R4, =DisIntPrioTmp)
   __as1(LDRB  R2, [R4])
   // BASEPRI = DisIntPrioTmp
   __as1(MSR  basepri, R2)
+#endif
 
   // evaluate amount of available NVIC_IPR regs within this Cortex-M* core
   DisIntITmp = (uint8)((get_NVIC_ICTR() & 0X0000000FU)+1u) << 5u;
@@ -307,20 +304,33 @@ static void STARTUP_v_HwDisableInterruptAtPowerOn(void)
 
 static inline void set_NVIC_IPR(uint8 idx, uint8 ui8_value)
 {
+#ifdef STARTUP_SIM_REG_ACCESS
+  STARTUP_v_SimWrite8(0xE000E400UL + (uint32)idx, ui8_value);
+#else
   //ToDo: get level 4 CCB approval
   (*((volatile uint8 *)(0xE000E400UL+(idx)))) = ui8_value;
+#endif
 }
 
 static inline uint32 get_NVIC_ICTR(void)
 {
+#ifdef STARTUP_SIM_REG_ACCESS
+  return STARTUP_u_SimRead32(0xE000E004UL);
+#else
   //ToDo: get level 4 CCB approval
   return (*((volatile uint32 *)(0xE000E004UL)));
+#endif
 }
 
 static inline uint32* get_pui32PtrToReg(uint32 Addr)
 {
+#ifdef STARTUP_SIM_REG_ACCESS
+  // host pointers are wider than the 32 bit addresses of the memory areas
+  return (uint32*)(uintptr_t)Addr;
+#else
   //ToDo: get level 4 CCB approval
   return (uint32*)Addr;
+#endif
 }
 
 #ifdef __cplusplus
@@ -0,0 +1,95 @@
+// Copyright (C) Continental AG
+// All Rights Reserved
+// COMPONENT: IuSbl
+/// @file     IuSbl_DpuStart.h
+/// @brief    Asynchronous DPU power-up and release of a set of CA53 cores
+
+#ifndef IUSBL_DPUSTART_H
+#define IUSBL_DPUSTART_H
+
+#include <Std_Types.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Number of CA53 cores which can be released.
+#define IUSBL_CA53_CORE_CNT        (4u)
+
+/// Timeout of each step of the core release handshake in SYS_TimeGetCount() ticks.
+#ifndef IUSBL_DPU_START_TIMEOUT
+#define IUSBL_DPU_START_TIMEOUT    (1000u)
+#endif
+
+/// No core release requested.
+#define IUSBL_DPU_START_IDLE       (0u)
+
+/// Core release handshake is running.
+#define IUSBL_DPU_START_BUSY       (1u)
+
+/// All requested cores are released from reset.
+#define IUSBL_DPU_START_DONE       (2u)
+
+/// Core release was rejected or a handshake step timed out.
+#define IUSBL_DPU_START_FAILED     (3u)
+
+/// Timeout of each step of the power-up sequence in SYS_TimeGetCount() ticks.
+#ifndef IUSBL_DPU_POWER_TIMEOUT
+#define IUSBL_DPU_POWER_TIMEOUT    (1000u)
+#endif
+
+/// Number of power resume requests issued before a denial (PWRER3) is reported as failure.
+#ifndef IUSBL_DPU_POWER_RETRIES
+#define IUSBL_DPU_POWER_RETRIES    (3u)
+#endif
+
+/// No power-up requested.
+#define IUSBL_DPU_POWER_IDLE       (0u)
+
+/// Power-up sequence is running.
+#define IUSBL_DPU_POWER_BUSY       (1u)
+
+/// CA53 power domain is in the non-shutoff state.
+#define IUSBL_DPU_POWER_DONE       (2u)
+
+/// Power-up was denied or a sequence step timed out.
+#define IUSBL_DPU_POWER_FAILED     (3u)
+
+/// Starts the power-up of the CA53 power domain (SCU / L2). \n
+/// Only the power mode is set, the SYSC handshake is executed by IuSbl_u_DPU_PollPowerOn().
+/// Calling it while a power-up is running or finished has no effect.
+/// @pre      System timer is running.
+/// @post     Power-up sequence is ongoing.
+/// @return   none
+void IuSbl_v_DPU_RequestPowerOn(void);
+
+/// Advances the power-up sequence without blocking. \n
+/// Intended to be called between other boot steps until the result is not IUSBL_DPU_POWER_BUSY.
+/// @pre      none
+/// @post     none
+/// @return   IUSBL_DPU_POWER_IDLE, _BUSY, _DONE or _FAILED
+uint8 IuSbl_u_DPU_PollPowerOn(void);
+
+/// Requests the wake-up of a set of CA53 cores in one CA53WUPCR access. \n
+/// The boot addresses are programmed into CA53CPUxBARL, the remaining handshake
+/// is executed by IuSbl_u_DPU_PollStart().
+/// @pre      DPU is powered (IuSbl_v_DPU_PowerOn), no core release is running.
+/// @post     Core release is ongoing.
+/// @param    u_CoreMask      bit n set releases CA53 core n
+/// @param    p_EntryPoints   boot address per core, only entries of cores in u_CoreMask are used
+/// @return   E_OK if the release was started, E_NOT_OK on invalid parameters or if busy
+Std_ReturnType IuSbl_u_DPU_StartCores(uint32 u_CoreMask, const uint32* p_EntryPoints);
+
+/// Advances the core release handshake without blocking. \n
+/// Intended to be called cyclically until the result is not IUSBL_DPU_START_BUSY.
+/// @pre      none
+/// @post     none
+/// @return   IUSBL_DPU_START_IDLE, _BUSY, _DONE or _FAILED
+uint8 IuSbl_u_DPU_PollStart(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // IUSBL_DPUSTART_H
@@ -11,6 +11,8 @@
 // Msg(4:0303) [I] Cast between a pointer to volatile object and an integral type.
 
 #include <IuSbl_part.h>
+#include <IuSbl_DpuStart.h>
+#include <sys_time.h>
 
 // Register access
 #ifndef __COURAGE_TEST_SWITCH__
@@ -34,21 +36,9 @@
 /// Returns content from CA53RESCNT register.
 #define BOARD_RST_CA53RESCNT   BOARD_REG_32(0xE6160044u)
 
-/// Accesses the CA53CPU0BARL value for IO. \n
-/// Returns content from CA53CPU0BARL register.
-#define BOARD_RST_CA53CPU0BARL BOARD_REG_32(0xE6160084u)
-
-/// Accesses the CA53CPU1BARL value for IO. \n
-/// Returns content from CA53CPU1BARL register.
-#define BOARD_RST_CA53CPU1BARL BOARD_REG_32(0xE6160094u)
-
-/// Accesses the CA53CPU2BARL value for IO. \n
-/// Returns content from CA53CPU2BARL register.
-#define BOARD_RST_CA53CPU2BARL BOARD_REG_32(0xE61600A4u)
-
-/// Accesses the CA53CPU3BARL value for IO. \n
-/// Returns content from CA53CPU3BARL register.
-#define BOARD_RST_CA53CPU3BARL BOARD_REG_32(0xE61600B4u)
+/// Accesses the CA53CPUnBARL value of CA53 core n for IO. \n
+/// Returns content from CA53CPUnBARL register.
+#define BOARD_RST_CA53CPUBARL(n) BOARD_REG_32(0xE6160084u + (0x10u * (uint32)(n)))
 
 /// Accesses the SYSCSR value for IO. \n
 /// Returns content from SYSCSR register.
@@ -90,36 +80,128 @@
 #define MEM_ALIGNMENT_MASK (0x00000003u)
 #endif
 
-// HIS metrics check
-// PRQA S 7010,2889 32
-// 2021-1-6; uie38801
-// Message(3:7010) HIS metric : no of exit points (too many return statements)
-// Message(2:2889) HIS metric : This function has more than one 'return' path.
-// Reason: non critical, if request is denied return, also return after non shut-off state is necessary
+/// Power-up step: waiting for SYSC to accept power-up requests.
+#define IUSBL_PWR_SYSC     (0u)
 
-void IuSbl_v_DPU_PowerOn(void)
-{
-  // set power mode
-//PRQA S 0303 1 // 0303_BOARD_REG_32
-  BOARD_CPG_CA53CPUCMCR = 0x00000000u;      // CA53 Common Power Control Register
+/// Power-up step: power resume sequence is being executed.
+#define IUSBL_PWR_SEQUENCE (1u)
 
-  // power-up CA53 L2 (SCU)
-//PRQA S 0303 1 // 0303_BOARD_REG_32
-  while ( ( BOARD_SYSC_SYSCSR & BIT1) != BIT1)  // wait for SYSC to accept power-up requests
-  {
+/// Power-up step: waiting for the non-shutoff state.
+#define IUSBL_PWR_STATE    (2u)
 
-  }
-//PRQA S 0303 2 // 0303_BOARD_REG_32
-  BOARD_SYSC_PWRONCR3 = BIT0;           // PoWeR resume Control Register: start power resume sequence
-  if ( BOARD_SYSC_PWRER3 != 0u )            // check if request was denied
+/// Result of the power-up, IUSBL_DPU_POWER_xxx.
+static uint8 u_DpuPowerState = IUSBL_DPU_POWER_IDLE;
+
+/// Current step of the power-up sequence.
+static uint8 u_DpuPowerStep = IUSBL_PWR_SYSC;
+
+/// Number of power resume requests issued.
+static uint8 u_DpuPowerRequests = 0u;
+
+/// Time stamp of the start of the current power-up step.
+static uint32 u_DpuPowerStepTime = 0u;
+
+/// Core release step: waiting for the CA53WUPCR wake-up sequence.
+#define IUSBL_STEP_WAKEUP  (0u)
+
+/// Core release step: waiting for already running cores to enter reset.
+#define IUSBL_STEP_RESET   (1u)
+
+/// Core release step: waiting for the cores to leave reset.
+#define IUSBL_STEP_RELEASE (2u)
+
+/// Result of the last core release, IUSBL_DPU_START_xxx.
+static uint8 u_DpuStartState = IUSBL_DPU_START_IDLE;
+
+/// Current step of the core release handshake.
+static uint8 u_DpuStartStep = IUSBL_STEP_WAKEUP;
+
+/// CA53RESCNT reset bits of the cores to be released.
+static uint32 u_DpuStartRstMask = 0u;
+
+/// Time stamp of the start of the current handshake step.
+static uint32 u_DpuStartStepTime = 0u;
+
+static void v_DPU_ReleaseReset(void);
+
+void IuSbl_v_DPU_RequestPowerOn(void)
+{
+  if (u_DpuPowerState == IUSBL_DPU_POWER_IDLE)
   {
-    return;
+    // set power mode
+//PRQA S 0303 1 // 0303_BOARD_REG_32
+    BOARD_CPG_CA53CPUCMCR = 0x00000000u;      // CA53 Common Power Control Register
+
+    u_DpuPowerStep = IUSBL_PWR_SYSC;
+    u_DpuPowerRequests = 0u;
+    u_DpuPowerStepTime = SYS_TimeGetCount();
+    u_DpuPowerState = IUSBL_DPU_POWER_BUSY;
   }
-  while ( BOARD_SYSC_PWRONSR3 != 0u )   //PRQA S 0303  // 0303_BOARD_REG_32     // wait while PoWeRON sequence is being executed
+}
+
+// PRQA S 2024 60
+// Message(3:2024) jump statement in switch default
+// Reason: default is not reachable, step is only set in this file.
+uint8 IuSbl_u_DPU_PollPowerOn(void)
+{
+  if (u_DpuPowerState == IUSBL_DPU_POWER_BUSY)
   {
+    switch (u_DpuPowerStep)
+    {
+      case IUSBL_PWR_SYSC:
+        // power-up CA53 L2 (SCU) as soon as SYSC accepts power-up requests
+        if ( (BOARD_SYSC_SYSCSR & BIT1) == BIT1) //PRQA S 0303 // 0303_BOARD_REG_32
+        {
+//PRQA S 0303 2 // 0303_BOARD_REG_32
+          BOARD_SYSC_PWRONCR3 = BIT0;           // PoWeR resume Control Register: start power resume sequence
+          u_DpuPowerRequests++;
+          if ( BOARD_SYSC_PWRER3 == 0u )        // request accepted
+          {
+            u_DpuPowerStep = IUSBL_PWR_SEQUENCE;
+            u_DpuPowerStepTime = SYS_TimeGetCount();
+          }
+          else if ( u_DpuPowerRequests >= IUSBL_DPU_POWER_RETRIES )
+          {
+            u_DpuPowerState = IUSBL_DPU_POWER_FAILED;
+          }
+          else
+          {
+            // request denied, retry once SYSC accepts requests again
+          }
+        }
+        break;
+
+      case IUSBL_PWR_SEQUENCE:
+        if ( BOARD_SYSC_PWRONSR3 == 0u ) //PRQA S 0303  // 0303_BOARD_REG_32 // PoWeRON sequence finished
+        {
+          u_DpuPowerStep = IUSBL_PWR_STATE;
+          u_DpuPowerStepTime = SYS_TimeGetCount();
+        }
+        break;
+
+      default:
+        if ( BOARD_SYSC_PWRSR3 == BIT4 ) //PRQA S 0303 // 0303_BOARD_REG_32 // module is in the non-shutoff state
+        {
+          u_DpuPowerState = IUSBL_DPU_POWER_DONE;
+        }
+        break;
+    }
 
+    if ( (u_DpuPowerState == IUSBL_DPU_POWER_BUSY) &&
+         (SYS_TimeGetSince(u_DpuPowerStepTime) >= IUSBL_DPU_POWER_TIMEOUT) )
+    {
+      u_DpuPowerState = IUSBL_DPU_POWER_FAILED;
+    }
   }
-  while ( BOARD_SYSC_PWRSR3 != BIT4 )   //PRQA S 0303 // 0303_BOARD_REG_32    // wait for module to be in the non-shutoff state
+
+  return u_DpuPowerState;
+}
+
+void IuSbl_v_DPU_PowerOn(void)
+{
+  // blocking variant: run the power-up sequence to its end
+  IuSbl_v_DPU_RequestPowerOn();
+  while (IuSbl_u_DPU_PollPowerOn() == IUSBL_DPU_POWER_BUSY)
   {
 
   }
@@ -127,73 +209,132 @@ void IuSbl_v_DPU_PowerOn(void)
   return;
 }
 
-// PRQA S 7002,2024,7010,3227,2889 97
-// 2021-1-6; uie38801
-// Message(3:7002) Amount of non-cyclic paths, minimum number of necessary test cases
-// Message(3:2024) jump statement in switch default
-// Message(3:7010) lot of exit points
-// Message(2:3227) The parameter 'u_CoreId' is never modified and so it could be declared with the 'const' qualifier.
-// Message(2:3227) The parameter 'u_EntryPoint' is never modified and so it could be declared with the 'const' qualifier.
-// Message(2:2889) This function has more than one 'return' path.
-// Reason: not critical, as these non cyclic paths are necessary. There is no need for explicitly define input parameters as const.
-// The function is provided to other modules, changing of interface may require chaning of many other modules.
-void IuSbl_v_DPU_Start(uint32 u_CoreId, uint32 u_EntryPoint)
+static void v_DPU_ReleaseReset(void)
 {
-  uint32 u_rst;
+  // clear the reset bits of all requested cores at once
+  //PRQA S 0303 1 // 0303_BOARD_REG_32
+  BOARD_RST_CA53RESCNT = RST_CODE_VALUE | (BOARD_RST_CA53RESCNT & ~u_DpuStartRstMask);
+  u_DpuStartStep = IUSBL_STEP_RELEASE;
+  u_DpuStartStepTime = SYS_TimeGetCount();
+}
+
+Std_ReturnType IuSbl_u_DPU_StartCores(uint32 u_CoreMask, const uint32* p_EntryPoints)
+{
+  Std_ReturnType u_Ret = E_OK;
+  uint32 u_Core;
 
-  // check sanity of boot addresses
-  if ( (u_EntryPoint & MEM_ALIGNMENT_MASK) != 0u)
+  if ( (u_DpuStartState == IUSBL_DPU_START_BUSY) || (p_EntryPoints == NULL) ||
+       (u_CoreMask == 0u) || ((u_CoreMask >> IUSBL_CA53_CORE_CNT) != 0u) )
   {
-    return;
+    u_Ret = E_NOT_OK;
   }
 
-  switch(u_CoreId)
+  // check sanity of boot addresses before touching any core
+  for (u_Core = 0u; (u_Ret == E_OK) && (u_Core < IUSBL_CA53_CORE_CNT); u_Core++)
   {
-    case COREID_CA53_0:
-      BOARD_RST_CA53CPU0BARL  = u_EntryPoint;//PRQA S 0303  // 0303_BOARD_REG_32
-      break;
-
-    case COREID_CA53_1:
-      BOARD_RST_CA53CPU1BARL  = u_EntryPoint;//PRQA S 0303  // 0303_BOARD_REG_32
-      break;
-
-    case COREID_CA53_2:
-      BOARD_RST_CA53CPU2BARL  = u_EntryPoint;//PRQA S 0303  // 0303_BOARD_REG_32
-      break;
-
-    case COREID_CA53_3:
-      BOARD_RST_CA53CPU3BARL  = u_EntryPoint;//PRQA S 0303  // 0303_BOARD_REG_32
-      break;
-
-    default:
-      return;
+    if ( ((u_CoreMask & (BIT0 << u_Core)) != 0u) && ((p_EntryPoints[u_Core] & MEM_ALIGNMENT_MASK) != 0u) )
+    {
+      u_Ret = E_NOT_OK;
+    }
   }
 
-  // wake up CA53 core
-  BOARD_CPG_CA53WUPCR =(uint32) (BIT0 << u_CoreId);   // request wake-up //PRQA S 0303  // 0303_BOARD_REG_32
-  while ( BOARD_CPG_CA53WUPCR != 0u ) //PRQA S 0303  // 0303_BOARD_REG_32 // wait until wake-up sequence is complete
+  if (u_Ret == E_OK)
   {
+    u_DpuStartRstMask = 0u;
+    for (u_Core = 0u; u_Core < IUSBL_CA53_CORE_CNT; u_Core++)
+    {
+      if ((u_CoreMask & (BIT0 << u_Core)) != 0u)
+      {
+        BOARD_RST_CA53CPUBARL(u_Core) = p_EntryPoints[u_Core]; //PRQA S 0303  // 0303_BOARD_REG_32
+        u_DpuStartRstMask |= (uint32)BIT3 >> u_Core;
+      }
+    }
 
+    // wake up all requested CA53 cores with one request
+    BOARD_CPG_CA53WUPCR = u_CoreMask; //PRQA S 0303  // 0303_BOARD_REG_32
+    u_DpuStartStep = IUSBL_STEP_WAKEUP;
+    u_DpuStartStepTime = SYS_TimeGetCount();
+    u_DpuStartState = IUSBL_DPU_START_BUSY;
   }
 
-  // check CA53 core reset state
-  u_rst = BOARD_RST_CA53RESCNT;  // current reset bits//PRQA S 0303  // 0303_BOARD_REG_32
-  if ( (u_rst & (BIT3 >> u_CoreId)) == 0x0u ) // already running ?
+  return u_Ret;
+}
+
+// PRQA S 2024 40
+// Message(3:2024) jump statement in switch default
+// Reason: default is not reachable, state is only set in this file.
+uint8 IuSbl_u_DPU_PollStart(void)
+{
+  uint32 u_rst;
+
+  if (u_DpuStartState == IUSBL_DPU_START_BUSY)
   {
-    u_rst |= (uint32)BIT3 >> u_CoreId;
-    BOARD_RST_CA53RESCNT = RST_CODE_VALUE | u_rst;  // assert reset //PRQA S 0303  // 0303_BOARD_REG_32
-    while ( (BOARD_RST_CA53RESCNT & (BIT3 >> u_CoreId)) == 0u ) //PRQA S 0303  // 0303_BOARD_REG_32
+    u_rst = BOARD_RST_CA53RESCNT; //PRQA S 0303  // 0303_BOARD_REG_32
+
+    switch (u_DpuStartStep)
     {
+      case IUSBL_STEP_WAKEUP:
+        if ( BOARD_CPG_CA53WUPCR == 0u ) //PRQA S 0303  // 0303_BOARD_REG_32 // wake-up sequence is complete
+        {
+          if ( (u_rst & u_DpuStartRstMask) != u_DpuStartRstMask ) // some cores already running ?
+          {
+            BOARD_RST_CA53RESCNT = RST_CODE_VALUE | u_rst | u_DpuStartRstMask;  // assert reset //PRQA S 0303  // 0303_BOARD_REG_32
+            u_DpuStartStep = IUSBL_STEP_RESET;
+            u_DpuStartStepTime = SYS_TimeGetCount();
+          }
+          else
+          {
+            v_DPU_ReleaseReset();
+          }
+        }
+        break;
+
+      case IUSBL_STEP_RESET:
+        if ( (u_rst & u_DpuStartRstMask) == u_DpuStartRstMask )
+        {
+          v_DPU_ReleaseReset();
+        }
+        break;
+
+      default:
+        if ( (u_rst & u_DpuStartRstMask) == 0u )
+        {
+          u_DpuStartState = IUSBL_DPU_START_DONE;
+        }
+        break;
+    }
 
+    if ( (u_DpuStartState == IUSBL_DPU_START_BUSY) &&
+         (SYS_TimeGetSince(u_DpuStartStepTime) >= IUSBL_DPU_START_TIMEOUT) )
+    {
+      u_DpuStartState = IUSBL_DPU_START_FAILED;
     }
   }
 
-  // release CA53 core from reset
-  u_rst &= ~(uint32)(BIT3 >> u_CoreId);  // clear bit to release reset
-  BOARD_RST_CA53RESCNT = RST_CODE_VALUE | u_rst; //PRQA S 0303  // 0303_BOARD_REG_32
-  while ( (BOARD_RST_CA53RESCNT & (BIT3 >> u_CoreId))!= 0u) //PRQA S 0303  // 0303_BOARD_REG_32
+  return u_DpuStartState;
+}
+
+// PRQA S 3227 10
+// 2021-1-6; uie38801
+// Message(2:3227) The parameter 'u_CoreId' is never modified and so it could be declared with the 'const' qualifier.
+// Message(2:3227) The parameter 'u_EntryPoint' is never modified and so it could be declared with the 'const' qualifier.
+// Reason: There is no need for explicitly define input parameters as const.
+// The function is provided to other modules, changing of interface may require chaning of many other modules.
+void IuSbl_v_DPU_Start(uint32 u_CoreId, uint32 u_EntryPoint)
+{
+  uint32 u_EntryPoints[IUSBL_CA53_CORE_CNT] = {0u, 0u, 0u, 0u};
+
+  if (u_CoreId < IUSBL_CA53_CORE_CNT)
   {
+    u_EntryPoints[u_CoreId] = u_EntryPoint;
+    if (IuSbl_u_DPU_StartCores(BIT0 << u_CoreId, u_EntryPoints) == E_OK)
+    {
+      // blocking variant: run the handshake to its end
+      while (IuSbl_u_DPU_PollStart() == IUSBL_DPU_START_BUSY)
+      {
 
+      }
+    }
   }
 
   return;
@@ -15,6 +15,7 @@
 #include <startup_r7.h>
 #include <memory_layout.h>
 #include <IuSbl_part.h>
+#include <IuSbl_DpuStart.h>
 #include <PreSBL_Loading.h>
 #include <image_loader.h>
 #include <ImageLoader_Cfg.h>
@@ -24,6 +25,7 @@
 #include <sys_time.h>
 #include <sys_mem.h>
 #include <Fls.h>
+#include <pal_qsf.h>
 #include <FS_Reset.h>
 #include <PAL_Watchdog.h>
 #include <Reg_RCarV3M.h>
@@ -35,6 +37,14 @@
 #include <PAL_Reset.h>
 
 #include <PMC_DpuStartup.h>
+#include <Startup_Ppar.h>
+#include <Startup_Ctors.h>
+#include <Startup_StackFill.h>
+#include <Startup_Clock.h>
+#include <Startup_Sched.h>
+#if (STARTUP_PPAR_FULL_COPY == STD_OFF)
+#include <Fls_Partition.h>
+#endif
 #ifdef __cplusplus
 extern "C"
 {
@@ -222,19 +232,112 @@ extern "C"
 // 2019-1-17; uidw1725
 // Msg(3:3218) File scope static, 'u_PPAR_SRAM', is only accessed in one function.
 // reason: reserve global PPAR memory area
-#ifndef __COURAGE_TEST_SWITCH__
+#if !defined(__COURAGE_TEST_SWITCH__) && (STARTUP_PPAR_FULL_COPY == STD_ON)
 
 /// Memory allocation for PPAR.
 static uint8 u_PPAR_SRAM[PPAR_SDF_LEN] __attribute__((section(".ppar_bu")));
 #endif
 
+#if (STARTUP_PPAR_FULL_COPY == STD_OFF)
+/// Number of lines of the on-demand PPAR cache.
+#define STARTUP_PPAR_CACHE_LINES     (4u)
+
+/// Size of one line of the on-demand PPAR cache in bytes, PPAR_SDF_LEN is a multiple of it.
+#define STARTUP_PPAR_CACHE_LINE_LEN  (64u)
+
+/// One line of the on-demand PPAR cache.
+typedef struct
+{
+  uint32 u_Offset;                                ///< PPAR offset of the line, valid if u_Stamp != 0
+  uint32 u_Stamp;                                 ///< last access stamp, 0 marks an empty line
+  uint8  u_Data[STARTUP_PPAR_CACHE_LINE_LEN];     ///< cached PPAR bytes
+} t_STARTUP_PparLine;
+
+/// On-demand PPAR cache, replaced in least recently used order.
+static t_STARTUP_PparLine s_PparCache[STARTUP_PPAR_CACHE_LINES];
+
+/// Access stamp of the on-demand PPAR cache.
+static uint32 u_PparStamp = 0u;
+
+#ifndef STARTUP_PPAR_READ_TIMEOUT
+/// Time in us a cache line read may wait for the flash driver.
+#define STARTUP_PPAR_READ_TIMEOUT  (10000u)
+#endif
+
+/// Partition handle of the on-demand PPAR read, uses the loader configuration.
+static tFlsPartition s_PparPart;
+
+/// TRUE once s_PparPart is registered at the flash driver.
+static boolean b_PparPartOpen = FALSE;
+#endif
+
+/// PPAR copy not started yet.
+#define STARTUP_PPAR_IDLE     (0u)
+
+/// PPAR read job is queued in the flash driver.
+#define STARTUP_PPAR_PENDING  (1u)
+
+/// PPAR data is available in SRAM.
+#define STARTUP_PPAR_DONE     (2u)
+
+/// Progress of the background PPAR copy.
+static uint8 u_PPARCopyState = STARTUP_PPAR_IDLE;
+
+/// Number of module clocks started by v_InitClocks().
+#define STARTUP_CLOCK_CNT  (6u)
+
+/// Module clocks started by v_InitClocks(), the index is the bit in u_STARTUP_ClockFailMask.
+/// I2C_IF4, TPU0, CSI0CKCR, SITSCR (module clock as master clock source), I2C_IF3, I2C_IF5
+static const t_STARTUP_ClockEnable s_ClockTable[STARTUP_CLOCK_CNT] =
+{
+  { &BOARD_CPGSMSTPCR9, &BOARD_CPGMSTPSR9,  BIT27,         STARTUP_CLOCK_REG32 }, //PRQA S 0303 // 0303_REG_32
+  { &BOARD_CPGSMSTPCR3, &BOARD_CPGMSTPSR3,  BIT04,         STARTUP_CLOCK_REG32 }, //PRQA S 0303 // 0303_REG_32
+  { &BOARD_CPGCSI0CKCR, &BOARD_CPGCSI0CKCR, BIT8,          STARTUP_CLOCK_REG32 }, //PRQA S 0303 // 0303_REG_32
+  { &BOARD_SITSCR,      &BOARD_SITSCR,      BIT14 | BIT15, STARTUP_CLOCK_REG16 }, //PRQA S 0303 // 0303_REG_32
+  { &BOARD_CPGSMSTPCR9, &BOARD_CPGMSTPSR9,  BIT28,         STARTUP_CLOCK_REG32 }, //PRQA S 0303 // 0303_REG_32
+  { &BOARD_CPGSMSTPCR9, &BOARD_CPGMSTPSR9,  BIT19,         STARTUP_CLOCK_REG32 }  //PRQA S 0303 // 0303_REG_32
+};
+
+#if (STARTUP_STACK_FILL_DEFERRED == 1)
+/// Offset in the kernel stack up to which the pattern is already written (guard band is filled at boot).
+static uint32 u_StackFillOffset = STARTUP_STACK_GUARD_LEN;
+#endif
+
 // PRQA S 1514 5
 // 2021-1-6; uie38801
 // Message(2:1514) The object 'v_CheckPoint' is only referenced by function 'u_STARTUP_CheckPoint', in the translation unit where it is defined
 // Reason: Component design
 volatile uint32 u_STARTUP_CheckPoint;
 
+/// Module clocks which did not start in v_InitClocks(), bit n refers to entry n of s_ClockTable.
+volatile uint32 u_STARTUP_ClockFailMask;
+
+/// DPU boot stages which did not complete in STARTUP_v_StartDpuSbl(), bit n refers to stage n.
+volatile uint32 u_STARTUP_DpuStageFailMask;
+
 static uint32 u_DpuSblEntry = 0U;
+
+/// Number of images loaded for the DPU (DPU SBL followed by DPU application).
+#define STARTUP_DPU_IMAGE_CNT (2u)
+
+/// Descriptor of one DPU image loaded by the pre-SBL image loader.
+typedef struct
+{
+  uint32      u_SdfStart;   ///< start address of the image in serial flash
+  const char* p_Name;       ///< rbin name of the image used for authentication
+} t_STARTUP_DpuImage;
+
+/// DPU images in load order. The first entry provides the DPU SBL entry point,
+/// the following entries are handed over to the DPU via BAI_SetDpuEntrypoint(). \n
+/// Each image is read and authenticated by one blocking PRESBL_LoadImage() call, so flash read
+/// and authentication of the images do not overlap. Only the stages not using the image loader
+/// (power-up, PPAR copy, key) run interleaved with the loads.
+static const t_STARTUP_DpuImage s_DpuImages[STARTUP_DPU_IMAGE_CNT] =
+{
+  { SDF_SBL_DPU_START,  SBL_DPU_RBIN_NAME },
+  { SDF_APPL_DPU_START, DPU_RBIN_NAME     }
+};
+
 /// Reference Source file : startup_r7.c
 ///
 /// @pre None
@@ -280,101 +383,14 @@ static void v_CheckPoint(const t_STARTUP_CheckPoint u_CheckPoint);
 ///
 /// activate startup_r7.c
 ///
-///    startup_r7.c -> sys_time.c: v_InitClocks() calls SYS_TimeGetCount()
-///    note left
-///       Result: None
-///    end note
-///    activate sys_time.c
-///       sys_time.c -> startup_r7.c: done
-///    deactivate sys_time.c
-///    startup_r7.c -> sys_time.c: v_InitClocks() calls SYS_TimeGetSince()
-///    note left
-///       Parameters: u_Start
-///       Result: None
-///    end note
-///    activate sys_time.c
-///       sys_time.c -> startup_r7.c: done
-///    deactivate sys_time.c
-///    startup_r7.c -> sys_time.c: v_InitClocks() calls SYS_TimeGetCount()
-///    note left
-///       Result: None
-///    end note
-///    activate sys_time.c
-///       sys_time.c -> startup_r7.c: done
-///    deactivate sys_time.c
-///    startup_r7.c -> sys_time.c: v_InitClocks() calls SYS_TimeGetSince()
-///    note left
-///       Call condition:  (BOARD_CPGMSTPSR9 & BIT27) == 0u
-///       Parameters: u_Start
-///       Result: None
-///    end note
-///    activate sys_time.c
-///       sys_time.c -> startup_r7.c: done
-///    deactivate sys_time.c
-///    startup_r7.c -> sys_time.c: v_InitClocks() calls SYS_TimeGetCount()
-///    note left
-///       Result: None
-///    end note
-///    activate sys_time.c
-///       sys_time.c -> startup_r7.c: done
-///    deactivate sys_time.c
-///    startup_r7.c -> sys_time.c: v_InitClocks() calls SYS_TimeGetSince()
-///    note left
-///       Call condition:  (BOARD_CPGMSTPSR3 & BIT04) == 0u
-///       Parameters: u_Start
-///       Result: None
-///    end note
-///    activate sys_time.c
-///       sys_time.c -> startup_r7.c: done
-///    deactivate sys_time.c
-///    startup_r7.c -> sys_time.c: v_InitClocks() calls SYS_TimeGetCount()
-///    note left
-///       Result: None
-///    end note
-///    activate sys_time.c
-///       sys_time.c -> startup_r7.c: done
-///    deactivate sys_time.c
-///    startup_r7.c -> sys_time.c: v_InitClocks() calls SYS_TimeGetSince()
-///    note left
-///       Call condition:  (BOARD_CPGCSI0CKCR & BIT8) == 0u
-///       Parameters: u_Start
-///       Result: None
-///    end note
-///    activate sys_time.c
-///       sys_time.c -> startup_r7.c: done
-///    deactivate sys_time.c
-///    startup_r7.c -> sys_time.c: v_InitClocks() calls SYS_TimeGetCount()
-///    note left
-///       Result: None
-///    end note
-///    activate sys_time.c
-///       sys_time.c -> startup_r7.c: done
-///    deactivate sys_time.c
-///    startup_r7.c -> sys_time.c: v_InitClocks() calls SYS_TimeGetSince()
-///    note left
-///       Call condition:  ((BOARD_SITSCR & BIT14) == 0u) && ((BOARD_SITSCR & BIT15) == 0u)
-///       Parameters: u_Start
-///       Result: None
-///    end note
-///    activate sys_time.c
-///       sys_time.c -> startup_r7.c: done
-///    deactivate sys_time.c
-///    startup_r7.c -> sys_time.c: v_InitClocks() calls SYS_TimeGetCount()
-///    note left
-///       Result: None
-///    end note
-///    activate sys_time.c
-///       sys_time.c -> startup_r7.c: done
-///    deactivate sys_time.c
-///    startup_r7.c -> sys_time.c: v_InitClocks() calls SYS_TimeGetSince()
+///    startup_r7.c -> Startup_Clock.c: v_InitClocks() calls STARTUP_u_EnableClocks()
 ///    note left
-///       Call condition:  (BOARD_CPGMSTPSR9 & BIT28) == 0u
-///       Parameters: u_Start
-///       Result: None
+///       Parameters: s_ClockTable, STARTUP_CLOCK_CNT, TIMEOUT100
+///       Result: mask of clocks which did not start
 ///    end note
-///    activate sys_time.c
-///       sys_time.c -> startup_r7.c: done
-///    deactivate sys_time.c
+///    activate Startup_Clock.c
+///       Startup_Clock.c -> startup_r7.c: done
+///    deactivate Startup_Clock.c
 /// deactivate startup_r7.c
 /// @enduml
 ///
@@ -387,6 +403,9 @@ static void v_CheckPoint(const t_STARTUP_CheckPoint u_CheckPoint);
 
 static void v_InitClocks(void);
 
+/// Cleans and invalidates the L1 D cache by set/way if it is enabled (startup_r7_asm.S).
+void STARTUP_v_CleanDCache(void);
+
 /// Watchdog Check Point setter \n \n
 /// This function will set the current watchdog state machine position.\n
 /// It can be one of the following items:\n
@@ -477,6 +496,16 @@ static void v_IndicateInitDone(void)
 /// @traceability
 
 
+#ifndef __COURAGE_TEST_SWITCH__
+/// Reaction on a NULL entry in the init array.
+static void v_CtorNullReaction(uint32 u_Index)
+{
+  (void)u_Index;
+  // Report error...init array entry is NULL pointer
+  FS_Reset_v_Cat2Reaction(FS_RESET_STARTUP_CONSTRUCTORS, NULL);
+}
+#endif
+
 /// This function is compiler specific. \n \n
 /// Loop through init_array and execute each constructor until we hit the end of the list. \n
 /// Calls the constructors of all static objects. \n
@@ -489,12 +518,6 @@ static void v_IndicateInitDone(void)
 #ifndef __COURAGE_TEST_SWITCH__
 static void v_call_ctors(void)
 {
-  // Define constructor function pointer type
-  typedef void  (*ctor_func_t)(void);//PRQA S 5004 
-// Message(3:5004) This typedef is applied to a pointer type.
-// Reason: Constructor function pointer type
-// 2023-09-11 ; uif92156
-
   // QAC does not support linker symbols with $$
 #ifdef __asm
 #define DUMMY_LOCATION_FOR_QAC (0x10u)
@@ -509,28 +532,8 @@ static void v_call_ctors(void)
   const uint32  size = &(SHT$$INIT_ARRAY$$Limit) - &(SHT$$INIT_ARRAY$$Base);
 #endif
 
-  ctor_func_t   ctor;
-  uint32        index;
-
-  // Loop through init_array and execute each constructor until we hit the end of the list
-  for (index = 0u; index < size; index++)
-  {
-    // PRQA S 0305 4
-    // 2020-03-25; uidv7790
-    // Msg(3:0305) [I] Cast between a pointer to function and an integral type.
-    // reason: Constructor pointer must be calculated from the table.
-    ctor = (ctor_func_t)(init_array[index] + (sint32)&init_array[index]); //PRQA S 0306
-    if ( ctor == NULL)
-    {
-      // Report error...init array entry is NULL pointer
-      FS_Reset_v_Cat2Reaction(FS_RESET_STARTUP_CONSTRUCTORS, NULL);
-    }
-    else
-    {
-      // Call constructor
-      (ctor)();
-    }
-  }
+  // Relative entries, every NULL entry is reported
+  STARTUP_v_RunCtors(init_array, size, STARTUP_CTOR_RELATIVE, &v_CtorNullReaction);
 }
 #endif
 // PRQA S 0602 14
@@ -545,122 +548,218 @@ void __cxa_atexit(void) //PRQA S 1503
 
 }
 
-void STARTUP_v_copyPPAR(void)
+void STARTUP_v_StartPPARCopy(void)
 {
-#ifdef CYBERSEC_ENABLED
-  Std_ReturnType ret;
-
-  ret = Load_xpar(PPAR_SDF_START, u_PPAR_SRAM, (uint32)PPAR_SDF_LEN);
-  if(E_OK != ret)
+#if (STARTUP_PPAR_FULL_COPY == STD_OFF)
+  if (STARTUP_PPAR_IDLE == u_PPARCopyState)
   {
-    // uif85744 19-1-2024
-    // Msg(3:2214) Body of control statement is on the same line and is not enclosed within braces.
-    // Reason : The 'while 'is dummy loop. It is no avoidable, no side effect.
-    // PRQA S 2214 1
-    while(1);
+    // PPAR is read on demand, only the flash driver is needed
+    Fls_Init(&s_QsfLoad);
+    u_PPARCopyState = STARTUP_PPAR_DONE;
   }
-#else
-  MemIf_JobResultType u_JobStatus;
+#elif !defined(CYBERSEC_ENABLED)
+  if (STARTUP_PPAR_IDLE == u_PPARCopyState)
+  {
+    // Initialize FLS for loading
+    Fls_Init(&s_QsfLoad);
 
-  // Initialize FLS for loading
-  Fls_Init(&s_QsfLoad);
+    // Queue copy of PPAR data into RAM, processed by STARTUP_b_PollPPARCopy()
+    (void)Fls_Read((uint32)PPAR_SDF_START, u_PPAR_SRAM, (uint32)PPAR_SDF_LEN);
+    u_PPARCopyState = STARTUP_PPAR_PENDING;
+  }
+#endif
+}
 
-  // Copy PPAR data into RAM
-  (void)Fls_Read((uint32)PPAR_SDF_START, u_PPAR_SRAM, (uint32)PPAR_SDF_LEN);
-  do
+boolean STARTUP_b_PollPPARCopy(void)
+{
+#ifndef CYBERSEC_ENABLED
+  if (STARTUP_PPAR_PENDING == u_PPARCopyState)
   {
     Fls_MainFunction();
-    u_JobStatus = Fls_GetJobResult();
-  } while (u_JobStatus == MEMIF_JOB_PENDING);
+    if (Fls_GetJobResult() != MEMIF_JOB_PENDING)
+    {
+      u_PPARCopyState = STARTUP_PPAR_DONE;
+    }
+  }
 #endif
+  return (STARTUP_PPAR_DONE == u_PPARCopyState) ? TRUE : FALSE;
 }
 
+void STARTUP_v_WaitPPARCopy(void)
+{
+#if defined(CYBERSEC_ENABLED) && (STARTUP_PPAR_FULL_COPY == STD_ON)
+  Std_ReturnType ret;
 
-// PRQA S 7002 ++
-// 2021-02-17; uie23485
-// Message(3:7002) Amount of non-cyclic paths, minimum number of necessary test cases
-// Reason: not critical, as these non cyclic paths are necessary.
+  if (STARTUP_PPAR_DONE != u_PPARCopyState)
+  {
+    ret = Load_xpar(PPAR_SDF_START, u_PPAR_SRAM, (uint32)PPAR_SDF_LEN);
+    if(E_OK != ret)
+    {
+      // uif85744 19-1-2024
+      // Msg(3:2214) Body of control statement is on the same line and is not enclosed within braces.
+      // Reason : The 'while 'is dummy loop. It is no avoidable, no side effect.
+      // PRQA S 2214 1
+      while(1);
+    }
+    u_PPARCopyState = STARTUP_PPAR_DONE;
+  }
+#else
+  STARTUP_v_StartPPARCopy();
+  while (FALSE == STARTUP_b_PollPPARCopy())
+  {
 
-/// Init clock tree registers which are not set elsewhere. \n
-/// This function will start following clocks:\n
-/// I2C_IF4, TPU0, CSI0CKCR, I2C_IF3, I2C_IF5
-static void v_InitClocks(void)
+  }
+#endif
+}
+
+void STARTUP_v_copyPPAR(void)
+{
+  // Blocking copy for integrations consuming PPAR before STARTUP_v_StartDpuSbl(). Otherwise the
+  // copy started in MK_InitHardwareAfterData() is finished as a stage of STARTUP_v_StartDpuSbl(),
+  // overlapped with the DPU power-up.
+  STARTUP_v_WaitPPARCopy();
+}
+
+#if (STARTUP_PPAR_FULL_COPY == STD_OFF)
+/// Reads one PPAR cache line as partition job, the job is scheduled by the flash driver like the
+/// jobs of the other flash users. Fls_MainFunction() is driven until the job is finished.
+static Std_ReturnType u_ReadPPARLine(const uint32 u_LineOffset, uint8* p_Line)
 {
-  uint32 u_Duration;
+  Std_ReturnType ret = E_OK;
+  MemIf_JobResultType u_Result;
   uint32 u_Start;
 
-  // Enable clock I2C_IF4
-  BOARD_CPGSMSTPCR9 &= ~(uint32)BIT27; //PRQA S 0303 // 0303_REG_32
-  u_Start = SYS_TimeGetCount();
-  do
+  if (FALSE == b_PparPartOpen)
+  {
+    ret = Fls_u_PartOpen(&s_PparPart, &s_QsfLoad);
+    b_PparPartOpen = (E_OK == ret) ? TRUE : FALSE;
+  }
+  if (E_OK == ret)
   {
-    u_Duration = SYS_TimeGetSince(u_Start);
-    if ( (BOARD_CPGMSTPSR9 & BIT27) == 0u) //PRQA S 0303 // 0303_REG_32
+    ret = Fls_u_PartRead(&s_PparPart, (uint32)PPAR_SDF_START + u_LineOffset, p_Line, STARTUP_PPAR_CACHE_LINE_LEN);
+  }
+  if (E_OK == ret)
+  {
+    u_Start = SYS_TimeGetCount();
+    do
     {
-      break;
+      Fls_MainFunction();
+      u_Result = Fls_u_PartGetJobResult(&s_PparPart);
+    } while ((MEMIF_JOB_PENDING == u_Result) && (SYS_TimeGetSince(u_Start) < STARTUP_PPAR_READ_TIMEOUT));
+    if (MEMIF_JOB_PENDING == u_Result)
+    {
+      // stop the read, it must not fill the line later and the handle is free for the next read
+      (void)Fls_u_PartCancel(&s_PparPart);
     }
-  } while (u_Duration < TIMEOUT100);
+    ret = (MEMIF_JOB_OK == u_Result) ? E_OK : E_NOT_OK;
+  }
+  return ret;
+}
 
-  // Enable clock TPU0
-  BOARD_CPGSMSTPCR3 &= ~(uint32)BIT04; //PRQA S 0303 // 0303_REG_32
-  u_Start = SYS_TimeGetCount();
-  do
+/// Returns the cache line holding the PPAR offset u_LineOffset, reading it from serial flash
+/// into the least recently used line on a miss. Returns NULL if the flash read failed.
+static const uint8* p_GetPPARLine(const uint32 u_LineOffset)
+{
+  uint32 u_Line;
+  uint32 u_Victim = 0u;
+  const uint8* p_Data = NULL;
+
+  u_PparStamp++;
+  for (u_Line = 0u; u_Line < STARTUP_PPAR_CACHE_LINES; u_Line++)
   {
-    u_Duration = SYS_TimeGetSince(u_Start);
-    if ( (BOARD_CPGMSTPSR3 & BIT04) == 0u) //PRQA S 0303 // 0303_REG_32
+    if ((0u != s_PparCache[u_Line].u_Stamp) && (u_LineOffset == s_PparCache[u_Line].u_Offset))
     {
+      s_PparCache[u_Line].u_Stamp = u_PparStamp;
+      p_Data = s_PparCache[u_Line].u_Data;
       break;
     }
-  } while (u_Duration < TIMEOUT100);
-
-  // Enable clock CSI0CKCR
-  BOARD_CPGCSI0CKCR &= ~(uint32)BIT8; //PRQA S 0303 // 0303_REG_32
-  u_Start = SYS_TimeGetCount();
-  do
-  {
-    u_Duration = SYS_TimeGetSince(u_Start);
-    if ( (BOARD_CPGCSI0CKCR & BIT8) == 0u) //PRQA S 0303 // 0303_REG_32
+    if (s_PparCache[u_Line].u_Stamp < s_PparCache[u_Victim].u_Stamp)
     {
-      break;
+      u_Victim = u_Line;
     }
-  } while (u_Duration < TIMEOUT100);
+  }
 
-  // SITSCR - Selects module clock as the source of master clock
-  BOARD_SITSCR &= (uint16) ~BIT14; //PRQA S 0303 // 0303_REG_32
-  BOARD_SITSCR &= (uint16) ~BIT15; //PRQA S 0303 // 0303_REG_32
-  u_Start = SYS_TimeGetCount();
-  do
+  if (NULL == p_Data)
   {
-    u_Duration = SYS_TimeGetSince(u_Start);
-    if ( ((BOARD_SITSCR & BIT14) == 0u) && ((BOARD_SITSCR & BIT15) == 0u)) //PRQA S 0303 // 0303_REG_32
+    s_PparCache[u_Victim].u_Stamp = 0u;
+    if (E_OK == u_ReadPPARLine(u_LineOffset, s_PparCache[u_Victim].u_Data))
     {
-      break;
+      s_PparCache[u_Victim].u_Offset = u_LineOffset;
+      s_PparCache[u_Victim].u_Stamp  = u_PparStamp;
+      p_Data = s_PparCache[u_Victim].u_Data;
     }
-  } while (u_Duration < TIMEOUT100);
+  }
+  return p_Data;
+}
+#endif
+
+Std_ReturnType STARTUP_u_ReadPPAR(uint32 u_Offset, uint8* p_Dest, uint32 u_Len)
+{
+  Std_ReturnType ret = E_OK;
+  uint32 u_Index;
+#if (STARTUP_PPAR_FULL_COPY == STD_OFF)
+  uint32 u_LineOffset;
+  uint32 u_Chunk;
+  const uint8* p_Line;
+#endif
 
-  // Enable clock I2C_IF3
-  BOARD_CPGSMSTPCR9 &= ~(uint32)BIT28; //PRQA S 0303 // 0303_REG_32
-  u_Start = SYS_TimeGetCount();
-  do
+  if ((NULL == p_Dest) || (u_Offset > PPAR_SDF_LEN) || (u_Len > (PPAR_SDF_LEN - u_Offset)))
   {
-    u_Duration = SYS_TimeGetSince(u_Start);
-    if ( (BOARD_CPGMSTPSR9 & BIT28) == 0u) //PRQA S 0303 // 0303_REG_32
+    ret = E_NOT_OK;
+  }
+  else
+  {
+#if (STARTUP_PPAR_FULL_COPY == STD_ON)
+    STARTUP_v_WaitPPARCopy();
+    for (u_Index = 0u; u_Index < u_Len; u_Index++)
     {
-      break;
+      p_Dest[u_Index] = u_PPAR_SRAM[u_Offset + u_Index];
     }
-  } while (u_Duration < TIMEOUT100);
-
-  // Enable clock I2C_IF5
-  BOARD_CPGSMSTPCR9 &= ~(uint32)BIT19; //PRQA S 0303 // 0303_REG_32
-  u_Start = SYS_TimeGetCount();
-  do
-  {
-    u_Duration = SYS_TimeGetSince(u_Start);
-    if ( (BOARD_CPGMSTPSR9 & BIT19) == 0u) //PRQA S 0303 // 0303_REG_32
+#else
+    while ((E_OK == ret) && (0u != u_Len))
     {
-      break;
+      u_LineOffset = u_Offset & ~(STARTUP_PPAR_CACHE_LINE_LEN - 1u);
+      p_Line = p_GetPPARLine(u_LineOffset);
+      if (NULL == p_Line)
+      {
+        ret = E_NOT_OK;
+      }
+      else
+      {
+        u_Chunk = STARTUP_PPAR_CACHE_LINE_LEN - (u_Offset - u_LineOffset);
+        if (u_Chunk > u_Len)
+        {
+          u_Chunk = u_Len;
+        }
+        for (u_Index = 0u; u_Index < u_Chunk; u_Index++)
+        {
+          // PRQA S 0488 1 // pointer arithmetic on the destination buffer
+          *p_Dest = p_Line[(u_Offset - u_LineOffset) + u_Index];
+          p_Dest++;
+        }
+        u_Offset += u_Chunk;
+        u_Len    -= u_Chunk;
+      }
     }
-  } while (u_Duration < TIMEOUT100);
+#endif
+  }
+  return ret;
+}
+
+
+// PRQA S 7002 ++
+// 2021-02-17; uie23485
+// Message(3:7002) Amount of non-cyclic paths, minimum number of necessary test cases
+// Reason: not critical, as these non cyclic paths are necessary.
+
+/// Init clock tree registers which are not set elsewhere. \n
+/// This function will start following clocks:\n
+/// I2C_IF4, TPU0, CSI0CKCR, I2C_IF3, I2C_IF5
+static void v_InitClocks(void)
+{
+  // Enable all module clocks, then wait once for all of them
+  u_STARTUP_ClockFailMask = STARTUP_u_EnableClocks(s_ClockTable, STARTUP_CLOCK_CNT, TIMEOUT100);
+
   //PRQA S 0303 14 // 0303_REG_32
   BOARD_CPGSD0CKCR = BOARD_CPGSD0CKCR_INIT_VAL; 
   BOARD_I2C5ICCCR  = BOARD_I2C5ICCCR_INIT_VAL;
@@ -679,21 +778,27 @@ static void v_InitClocks(void)
 }
 // PRQA S 7002 --
 
-void STARTUP_v_StartDpuSbl(void)
+/// Boot stages of the DPU start, the index is the bit used in the dependency masks.
+#define STARTUP_STAGE_POWER      (0u)   ///< power-up of the CA53 domain
+#define STARTUP_STAGE_PPAR       (1u)   ///< PPAR copy, owns the flash driver
+#define STARTUP_STAGE_KEY        (2u)   ///< secure boot key
+#define STARTUP_STAGE_LOAD_SBL   (3u)   ///< load and authenticate the DPU SBL
+#define STARTUP_STAGE_LOAD_APPL  (4u)   ///< load and authenticate the DPU application
+#define STARTUP_STAGE_HANDOVER   (5u)   ///< hand over flash to NvM
+#define STARTUP_STAGE_RELEASE    (6u)   ///< release of the first A53 core
+#define STARTUP_STAGE_CNT        (7u)
+
+/// Dependency mask bit of a DPU boot stage.
+#define STARTUP_STAGE_BIT(n)     (1uL << (n))
+
+/// Loads one DPU image, an image which cannot be loaded invalidates the application and resets.
+static uint32 u_LoadDpuImage(const uint32 u_Index)
 {
-  uint32 u_DpuEntry = 0U;
-  uint8  u_IsEvsDpu = FALSE;
-  // Enable Power Domains
-  IuSbl_v_DPU_PowerOn();
+  uint32 u_Entry;
 
-  // Key must always be set to valid to be usable within the Crypto HW Driver
-  // HW key already stored in ICUMX
-  (void)Csm_KeySetValid(SecureBootAuthKey);
-  // load DPU_SBL
-  u_DpuSblEntry = PRESBL_LoadImage(SDF_SBL_DPU_START, SBL_DPU_RBIN_NAME, 0U);
-  
-  if(u_DpuSblEntry == 0U)
-  {	     
+  u_Entry = PRESBL_LoadImage(s_DpuImages[u_Index].u_SdfStart, s_DpuImages[u_Index].p_Name, 0U);
+  if (0U == u_Entry)
+  {
     // uif85744 19-01-2024
     // Msg(3:1295)  An integer constant of 'essentially unsigned' type is being converted to type _Bool on assignment.
     // Msg(3:4424)  An expression of 'essentially enum' type (InfoBlockStructure_e_InfoBlockIdExt) is being converted to unsigned type, 'unsigned char' on assignment.
@@ -702,39 +807,163 @@ void STARTUP_v_StartDpuSbl(void)
     FBLSDF_u_b_NvmSetApplicationValidFlag(APPL_IBID_EXT, FALSE);
     Pal_v_Reset(PAL_RESET_FUNCTIONAL);
   }
-  else
+  return u_Entry;
+}
+
+/// Boot stage: power-up of the CA53 domain.
+static uint8 u_StagePower(void)
+{
+  uint8 u_Ret = STARTUP_STAGE_BUSY;
+
+  // Enable Power Domains, the power-up settles while the other stages run
+  IuSbl_v_DPU_RequestPowerOn();
+  switch (IuSbl_u_DPU_PollPowerOn())
   {
-    u_IsEvsDpu = PRESBL_v_IsEvsDpu();
-    if(FALSE == u_IsEvsDpu)
+    case IUSBL_DPU_POWER_DONE:
+      u_Ret = STARTUP_STAGE_DONE;
+      break;
+    case IUSBL_DPU_POWER_FAILED:
+      u_Ret = STARTUP_STAGE_FAILED;
+      break;
+    default:
+      break;
+  }
+  return u_Ret;
+}
+
+/// Boot stage: PPAR copy from serial flash. \n
+/// The copy is started by MK_InitHardwareAfterData() and overlaps the timer and constructor init.
+/// The stage loop polls the rest once per round, so the flash driver progresses while the power-up settles.
+static uint8 u_StagePpar(void)
+{
+#if defined(CYBERSEC_ENABLED) && (STARTUP_PPAR_FULL_COPY == STD_ON)
+  STARTUP_v_WaitPPARCopy();
+  return STARTUP_STAGE_DONE;
+#else
+  STARTUP_v_StartPPARCopy();
+  return (FALSE != STARTUP_b_PollPPARCopy()) ? STARTUP_STAGE_DONE : STARTUP_STAGE_BUSY;
+#endif
+}
+
+/// Boot stage: validate the secure boot key.
+static uint8 u_StageKey(void)
+{
+  // Key must always be set to valid to be usable within the Crypto HW Driver
+  // HW key already stored in ICUMX.
+  (void)Csm_KeySetValid(SecureBootAuthKey);
+  return STARTUP_STAGE_DONE;
+}
+
+/// Boot stage: load and authenticate the DPU SBL.
+static uint8 u_StageLoadSbl(void)
+{
+  u_DpuSblEntry = u_LoadDpuImage(0u);
+  return (0U != u_DpuSblEntry) ? STARTUP_STAGE_DONE : STARTUP_STAGE_FAILED;
+}
+
+/// Boot stage: load and authenticate the DPU application images.
+static uint8 u_StageLoadAppl(void)
+{
+  uint8  u_Ret = STARTUP_STAGE_DONE;
+  uint32 u_Index;
+  uint32 u_Entry;
+
+  // EVS variant runs without a separate DPU application image
+  if (FALSE == PRESBL_v_IsEvsDpu())
+  {
+    for (u_Index = 1u; (u_Index < STARTUP_DPU_IMAGE_CNT) && (u_Ret == STARTUP_STAGE_DONE); u_Index++)
     {
-      u_DpuEntry = PRESBL_LoadImage(SDF_APPL_DPU_START, DPU_RBIN_NAME, 0U);
-      if(0U == u_DpuEntry)
+      u_Entry = u_LoadDpuImage(u_Index);
+      if (0U == u_Entry)
       {
-        FBLSDF_u_b_NvmSetApplicationValidFlag(APPL_IBID_EXT, FALSE);
-        Pal_v_Reset(PAL_RESET_FUNCTIONAL);
+        u_Ret = STARTUP_STAGE_FAILED;
       }
       else
       {
-        BAI_SetDpuEntrypoint(u_DpuEntry);
+        BAI_SetDpuEntrypoint(u_Entry);
       }
     }
   }
+  return u_Ret;
+}
+
+/// Frees the PMC lock and hands over the flash driver to NvM. Runs as boot stage or, if a
+/// load stage failed, after the stage loop.
+static void v_HandoverFls(void)
+{
   //Free the PMC lock
-  PMC_v_FreeSDFLock(); 
+  PMC_v_FreeSDFLock();
+
+  // other masters may have used the RPC and the SDF, re-probe and configure the device
+  PAL_v_QsfForceColdInit();
 
   // now we can switch Fls config to NvM on infra side
   Fls_Init(&s_QsfApplNvm);
-  STARTUP_v_RunDpuSbl();
-  return;
 }
 
-void STARTUP_v_RunDpuSbl(void)
+/// Boot stage: hand over the flash driver to NvM.
+static uint8 u_StageHandover(void)
+{
+  v_HandoverFls();
+  return STARTUP_STAGE_DONE;
+}
+
+/// Boot stage: release the first A53 core into the DPU SBL.
+static uint8 u_StageRelease(void)
+{
+  uint8  u_Ret = STARTUP_STAGE_BUSY;
+  uint32 u_EntryPoints[IUSBL_CA53_CORE_CNT] = {0u, 0u, 0u, 0u};
+
+  switch (IuSbl_u_DPU_PollStart())
+  {
+    case IUSBL_DPU_START_IDLE:
+      // Start 1st A53 core, the handshake is completed by the following calls
+      u_EntryPoints[COREID_CA53_0] = u_DpuSblEntry;
+      if (E_OK != IuSbl_u_DPU_StartCores((uint32)1u << COREID_CA53_0, u_EntryPoints))
+      {
+        u_Ret = STARTUP_STAGE_FAILED;
+      }
+      break;
+    case IUSBL_DPU_START_DONE:
+      u_Ret = STARTUP_STAGE_DONE;
+      break;
+    case IUSBL_DPU_START_FAILED:
+      u_Ret = STARTUP_STAGE_FAILED;
+      break;
+    default:
+      break;
+  }
+  return u_Ret;
+}
+
+/// DPU boot stages and their dependencies. Flash is owned by the PPAR copy first, then by
+/// the image loader and finally handed over to NvM; the power-up runs in parallel.
+static const t_STARTUP_Stage s_DpuStages[STARTUP_STAGE_CNT] =
+{
+  { &u_StagePower,    0u },
+  { &u_StagePpar,     0u },
+  { &u_StageKey,      0u },
+  { &u_StageLoadSbl,  STARTUP_STAGE_BIT(STARTUP_STAGE_PPAR) | STARTUP_STAGE_BIT(STARTUP_STAGE_KEY) },
+  { &u_StageLoadAppl, STARTUP_STAGE_BIT(STARTUP_STAGE_LOAD_SBL) },
+  { &u_StageHandover, STARTUP_STAGE_BIT(STARTUP_STAGE_LOAD_APPL) },
+  { &u_StageRelease,  STARTUP_STAGE_BIT(STARTUP_STAGE_POWER) | STARTUP_STAGE_BIT(STARTUP_STAGE_HANDOVER) }
+};
+
+/// KPI record (state, start and end time) of every DPU boot stage.
+static t_STARTUP_StageKpi s_DpuStageKpi[STARTUP_STAGE_CNT];
+
+void STARTUP_v_StartDpuSbl(void)
 {
-  if(0U != u_DpuSblEntry)
+  // run the DPU boot stages interleaved, boot time is given by the critical path
+  u_STARTUP_DpuStageFailMask = STARTUP_u_RunStages(s_DpuStages, s_DpuStageKpi, STARTUP_STAGE_CNT);
+
+  // The lock and the flash driver are handed over on every outcome, a failed image load
+  // skips the handover stage but the NvM still needs the flash after the reset request
+  if (0u != (u_STARTUP_DpuStageFailMask & STARTUP_STAGE_BIT(STARTUP_STAGE_HANDOVER)))
   {
-  // Start 1st A53 core
-  IuSbl_v_DPU_Start(COREID_CA53_0, u_DpuSblEntry);
+    v_HandoverFls();
   }
+  return;
 }
 
 
@@ -788,18 +1017,77 @@ void MK_InitHardwareAfterData(void)   //PRQA S 1503
   // Start the ARM global timer
   BOARD_ARM_GLOBAL_TIMER_CTRL |= 0x1u;
 
+  // Copy PPAR in the background while the remaining init is running, the SDF lock is
+  // held from reset until the flash driver is handed over to NvM
+  STARTUP_v_StartPPARCopy();
+
   // Perform the initialization of the PMU to be used as QM-OS timer, that
   // requires to be run in privileged mode.
 
   OS_ARM_Timer_PmuInitPriv();
+  (void)STARTUP_b_PollPPARCopy();
 
   v_call_ctors();
+  (void)STARTUP_b_PollPPARCopy();
 
   v_CheckPoint(STARTUP_CP_PER_INIT_DONE);
 
   // Indicate that Init is done and next is handover to OS
   v_IndicateInitDone();
 
+  // The OS re-programs the MPU next, write back the lines cached since STARTUP_EARLY_DCACHE
+  STARTUP_v_CleanDCache();
+
+}
+
+boolean STARTUP_b_FillStackDeferred(void)
+{
+#if (STARTUP_STACK_FILL_DEFERRED == 1)
+  // QAC does not support linker symbols with $$
+#ifdef __asm
+#define DUMMY_STACK_LOCATION_FOR_QAC (0x10u)
+  uint32* p_StackBase = (uint32*)DUMMY_STACK_LOCATION_FOR_QAC; //PRQA S 0306
+  const uint32 u_StackSize = 0x10u;
+#else
+  // Import kernel stack range from linker
+  extern uint32 Image$$data_MK_c0_kernelStack$$Base;
+  extern uint32 Image$$bss_MK_c0_kernelStack$$ZI$$Limit;
+
+  uint32* p_StackBase = &(Image$$data_MK_c0_kernelStack$$Base);
+  const uint32 u_StackSize = (uint32)((uint8*)&(Image$$bss_MK_c0_kernelStack$$ZI$$Limit) - (uint8*)p_StackBase);
+#endif
+  uint32 u_End;
+  uint32 u_Idx;
+
+  if (FALSE == STARTUP_b_IsPrivileged())
+  {
+    // Writing the kernel stack from user mode raises an MPU fault, see Startup_StackFill.h
+  }
+  else if (u_StackFillOffset < u_StackSize)
+  {
+    u_End = u_StackFillOffset + STARTUP_STACK_FILL_CHUNK;
+    if (u_End > u_StackSize)
+    {
+      u_End = u_StackSize;
+    }
+
+    // The kernel stack is only used by exception handlers, with interrupts locked
+    // no frame is live in the range and the pattern can be written.
+    STARTUP_STACK_FILL_LOCK();
+    for (u_Idx = u_StackFillOffset / 4u; u_Idx < (u_End / 4u); u_Idx++)
+    {
+      p_StackBase[u_Idx] = STARTUP_STACK_PATTERN;
+    }
+    STARTUP_STACK_FILL_UNLOCK();
+
+    u_StackFillOffset = u_End;
+  }
+
+  return (u_StackFillOffset >= u_StackSize) ? TRUE : FALSE;
+#else
+  // Complete stack was filled at boot
+  return TRUE;
+#endif
 }
 
 // PRQA S 3469 15
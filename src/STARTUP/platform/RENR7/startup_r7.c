@@ -20,6 +20,9 @@
 #include <Mk_qmboard.h>
 #include <PAL_McuDefs.h>
 #include <Mk_ARM_exceptionhandling.h>
+#include <Startup_Ppar.h>
+#include <Startup_Ctors.h>
+#include <Startup_Clock.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -81,9 +84,18 @@ extern "C"
 // reason: reserve global PPAR memory area
 static uint8 u_PPAR_SRAM[PPAR_SDF_LEN] __attribute__((section(".ppar_bu")));
 
+// progress of the background PPAR copy
+#define STARTUP_PPAR_IDLE     (0u)
+#define STARTUP_PPAR_PENDING  (1u)
+#define STARTUP_PPAR_DONE     (2u)
+static uint8 u_PPARCopyState = STARTUP_PPAR_IDLE;
+
 // holds check points for startup
 volatile uint32 u_STARTUP_CheckPoint;
 
+// Module clocks which did not start in v_InitClocks(), bit n refers to entry n of s_ClockTable
+volatile uint32 u_STARTUP_ClockFailMask;
+
 // Watchdog Check Point setting
 static void v_CheckPoint(t_STARTUP_CheckPoint u_CheckPoint)
 {
@@ -96,6 +108,14 @@ static void v_IndicateInitDone(void)
   v_CheckPoint(STARTUP_CP_INIT_DONE);
 }
 
+/// Reaction on a NULL entry in the init array.
+static void v_CtorNullReaction(uint32 u_Index)
+{
+  (void)u_Index;
+  // Report error...init array entry is NULL pointer
+  FS_Reset_v_Cat2Reaction(FS_RESET_STARTUP_CONSTRUCTORS, NULL);
+}
+
 /// @brief    Calls the contructors of all static objects
 ///           Linker stores in special section INIT_ARRAY a table with all constructors
 ///           as function pointer. The function pointers are not absolute addresses but 
@@ -108,9 +128,6 @@ static void v_IndicateInitDone(void)
 /// @globals  none
 static void v_call_ctors(void)
 {
-  // Define constructor function pointer type
-  typedef void (*ctor_func_t)(void);
-
 // QAC does not support linker symbols with $$
 #ifdef __asm
   #define DUMMY_LOCATION_FOR_QAC (0x10u)
@@ -125,28 +142,8 @@ static void v_call_ctors(void)
   const uint32 size = &(SHT$$INIT_ARRAY$$Limit) - &(SHT$$INIT_ARRAY$$Base);
 #endif
 
-  ctor_func_t ctor;
-  uint32 index;
-
-  // Loop through init_array and execute each constructor until we hit the end of the list
-  for (index = 0u; index < size; index++)
-  {
-    // PRQA S 0305 4
-    // 2020-03-25; uidv7790
-    // Msg(3:0305) [I] Cast between a pointer to function and an integral type.
-    // reason: Constructor pointer must be calculated from the table.
-    ctor = (ctor_func_t)(init_array[index] + (sint32)&init_array[index]);
-    if ( ctor == NULL)
-    {
-      // Report error...init array entry is NULL pointer
-      FS_Reset_v_Cat2Reaction(FS_RESET_STARTUP_CONSTRUCTORS, NULL);
-    }
-    else
-    {
-      // Call constructor
-      (ctor)();
-    }
-  }
+  // Relative entries, every NULL entry is reported
+  STARTUP_v_RunCtors(init_array, size, STARTUP_CTOR_RELATIVE, &v_CtorNullReaction);
 }
 /// The below implementation is commented out as this can be solved by having -fno-use-cxa-atexit compile flag.
 /// __aeabi_atexit()
@@ -169,25 +166,77 @@ void __aeabi_atexit()
 
 }
 
-// Copy PPAR data from SDF to SRAM section .ppar_bu
-void STARTUP_v_copyPPAR(void)
+// Queue copy of PPAR data from SDF to SRAM section .ppar_bu
+void STARTUP_v_StartPPARCopy(void)
 {
+	if (STARTUP_PPAR_IDLE == u_PPARCopyState)
+	{
+		//initialize FLS for loading
+		Fls_Init(&s_QsfLoad);
 
-	MemIf_JobResultType u_JobStatus;
-
-	//initialize FLS for loading
-	Fls_Init(&s_QsfLoad);
+		//Copy data from source to destination, processed by STARTUP_b_PollPPARCopy()
+		(void)Fls_Read((uint32)PPAR_SDF_START, u_PPAR_SRAM, PPAR_SDF_LEN);
+		u_PPARCopyState = STARTUP_PPAR_PENDING;
+	}
+}
 
-	//Copy data from source to destination
-	(void)Fls_Read((uint32)PPAR_SDF_START, u_PPAR_SRAM, PPAR_SDF_LEN);
-	do
+// Advance pending PPAR copy by one flash driver step
+boolean STARTUP_b_PollPPARCopy(void)
+{
+	if (STARTUP_PPAR_PENDING == u_PPARCopyState)
 	{
 		Fls_MainFunction();
-		u_JobStatus = Fls_GetJobResult();
-	} while (u_JobStatus == MEMIF_JOB_PENDING);
+		if (Fls_GetJobResult() != MEMIF_JOB_PENDING)
+		{
+			u_PPARCopyState = STARTUP_PPAR_DONE;
+		}
+	}
+	return (STARTUP_PPAR_DONE == u_PPARCopyState) ? TRUE : FALSE;
+}
+
+// Block until PPAR data is available in SRAM
+void STARTUP_v_WaitPPARCopy(void)
+{
+	STARTUP_v_StartPPARCopy();
+	while (FALSE == STARTUP_b_PollPPARCopy())
+	{
+	}
+}
 
+// Copy PPAR data from SDF to SRAM section .ppar_bu
+void STARTUP_v_copyPPAR(void)
+{
+	STARTUP_v_WaitPPARCopy();
 }
 
+// Read a range of PPAR, always served from the SRAM copy on this platform
+Std_ReturnType STARTUP_u_ReadPPAR(uint32 u_Offset, uint8* p_Dest, uint32 u_Len)
+{
+	Std_ReturnType ret = E_NOT_OK;
+	uint32 u_Index;
+
+	if ((NULL != p_Dest) && (u_Offset <= PPAR_SDF_LEN) && (u_Len <= (PPAR_SDF_LEN - u_Offset)))
+	{
+		STARTUP_v_WaitPPARCopy();
+		for (u_Index = 0u; u_Index < u_Len; u_Index++)
+		{
+			p_Dest[u_Index] = u_PPAR_SRAM[u_Offset + u_Index];
+		}
+		ret = E_OK;
+	}
+	return ret;
+}
+
+
+#define STARTUP_CLOCK_CNT  (2u)
+
+// Module clocks started by v_InitClocks(): I2C_IF4, TPU0
+// the index is the bit in u_STARTUP_ClockFailMask
+static const t_STARTUP_ClockEnable s_ClockTable[STARTUP_CLOCK_CNT] =
+{
+	{ &BOARD_CPGSMSTPCR9, &BOARD_CPGMSTPSR9, BIT27, STARTUP_CLOCK_REG32 },
+	{ &BOARD_CPGSMSTPCR3, &BOARD_CPGMSTPSR3, BIT04, STARTUP_CLOCK_REG32 }
+};
 
 /// @brief                         Init clock tree registers which are not set elsewhere
 ///
@@ -196,7 +245,7 @@ void STARTUP_v_copyPPAR(void)
 ///
 /// @return                       none
 ///
-/// @globals                      none
+/// @globals                      u_STARTUP_ClockFailMask
 ///
 /// @InOutCorrelation             TBD
 /// @startuml
@@ -207,32 +256,8 @@ void STARTUP_v_copyPPAR(void)
 /// @enduml
 static void v_InitClocks(void)
 {
-  uint32 u_Duration;
-  uint32 u_Start;
-
-  // Enable clock I2C_IF4
-  BOARD_CPGSMSTPCR9 &= ~BIT27;
-  u_Start = SYS_TimeGetCount();
-  do
-  {
-    u_Duration = SYS_TimeGetSince(u_Start);
-    if ( (BOARD_CPGMSTPSR9 & BIT27) == 0u)
-    {
-      break;
-    }
-  } while (u_Duration < TIMEOUT100);
-
-  // Enable clock TPU0
-  BOARD_CPGSMSTPCR3 &= ~BIT04;
-  u_Start = SYS_TimeGetCount();
-  do
-  {
-    u_Duration = SYS_TimeGetSince(u_Start);
-    if ( (BOARD_CPGMSTPSR3 & BIT04) == 0u)
-    {
-      break;
-    }
-  } while (u_Duration < TIMEOUT100);
+  // Enable all module clocks, then wait once for all of them
+  u_STARTUP_ClockFailMask = STARTUP_u_EnableClocks(s_ClockTable, STARTUP_CLOCK_CNT, TIMEOUT100);
 
   BOARD_CPGSD0CKCR = BOARD_CPGSD0CKCR_INIT_VAL;
   BOARD_I2C4ICCCR  = BOARD_I2C4ICCCR_INIT_VAL;
@@ -243,6 +268,10 @@ void STARTUP_v_StartDpuSbl(void)
 {
   uint32 u_DpuSblEntry;
 
+  // Finish the PPAR copy started in MK_InitHardwareAfterData() before the image loader
+  // takes over the flash driver
+  STARTUP_v_WaitPPARCopy();
+
   // Enable Power Domains
   IuSbl_v_DPU_PowerOn();
 
@@ -309,12 +338,18 @@ void MK_InitHardwareAfterData(void)
   // Start the ARM global timer
   BOARD_ARM_GLOBAL_TIMER_CTRL |= 0x1u;
 
+  // Copy PPAR in the background while the remaining init is running, the SDF lock is
+  // held from reset until the flash driver is handed over to NvM
+  STARTUP_v_StartPPARCopy();
+
   // Perform the initialization of the PMU to be used as QM-OS timer, that
   // requires to be run in privileged mode.
 
   OS_ARM_Timer_PmuInitPriv();
+  (void)STARTUP_b_PollPPARCopy();
 
   v_call_ctors();
+  (void)STARTUP_b_PollPPARCopy();
 
   v_CheckPoint(STARTUP_CP_PER_INIT_DONE);
 
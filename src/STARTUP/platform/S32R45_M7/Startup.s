@@ -1,23 +1,55 @@
+.syntax unified
 
 /******************************************************************/
-/* Core M7_0 startup code                                         */
+/* Configuration (override with --defsym)                         */
 /******************************************************************/
-.globl OsCfg_Hal_Core_OsCore0_VectorTable
-.section ".startup_c0","ax"
-.syntax unified
-.thumb
+/* 1: core 0 calls Startup_ReleaseSecondaryCores before clearing  */
+/*    its TCM so the secondary cores boot concurrently            */
+.ifndef STARTUP_EARLY_RELEASE
+.set STARTUP_EARLY_RELEASE, 0
+.endif
+
+/* 1: each core calls Startup_CoreDataInit(core id) before main   */
+.ifndef STARTUP_CORE_DATA_INIT
+.set STARTUP_CORE_DATA_INIT, 0
+.endif
+
+.set VTOR_REG,        0xE000ED08
+.set DEMCR_REG,       0xE000EDFC
+.set DWT_CTRL_REG,    0xE0001000
+.set DWT_CYCCNT_REG,  0xE0001004
+.set DWT_LAR_REG,     0xE0001FB0
+.set DWT_LAR_KEY,     0xC5ACCE55
+.set TCM_START,       0x20000000
+.set TCM_END,         0x20010000
+.set STARTUP_CORE_CNT, 3
+.set STARTUP_CORE_READY, 0x52454459   /* "REDY" */
 
-.set VTOR_REG, 0xE000ED08
+/******************************************************************/
+/* Per core boot state shared between the cores                   */
+/* Section must be mapped to shared, non cached SRAM that is not  */
+/* cleared by the C runtime initialization.                       */
+/******************************************************************/
+.section ".startup_shared","aw",%nobits
 .align 2
-.globl CATCH_CORE_RESET
+/* ready flag per core, STARTUP_CORE_READY when the core reached main */
+.globl STARTUP_au_CoreReady
+STARTUP_au_CoreReady:
+.space (4 * STARTUP_CORE_CNT)
+/* KPI per core: DWT cycle count at reset entry and before main    */
+.globl STARTUP_au_CoreKpi
+STARTUP_au_CoreKpi:
+.space (8 * STARTUP_CORE_CNT)
 
-.globl Reset_Handler 
-Reset_Handler:
-.globl _start
-_start:
-/********************************************/
-/* Clear General Purpose Registers          */
-/********************************************/
+/******************************************************************/
+/* Shared per core init sequence                                  */
+/* vtable: vector table, stack: initial MSP, core: core index,    */
+/* entry: main routine of the core                                */
+/******************************************************************/
+.macro STARTUP_CORE_INIT vtable, stack, core, entry
+/*******************************************/
+/* Clear General Purpose Registers         */
+/*******************************************/
  mov   r0,  #0
  mov   r1,  #0
  mov   r2,  #0
@@ -30,12 +62,31 @@ _start:
  mov   r9,  #0
  mov   r10, #0
  mov   r11, #0
- 
+
+/*******************************************/
+/* Start KPI cycle counter                 */
+/*******************************************/
+ldr  r0, =DEMCR_REG
+ldr  r1, [r0]
+orr  r1, r1, #(1 << 24)   /* TRCENA */
+str  r1, [r0]
+ldr  r0, =DWT_LAR_REG
+ldr  r1, =DWT_LAR_KEY
+str  r1, [r0]
+ldr  r0, =DWT_CTRL_REG
+ldr  r1, [r0]
+orr  r1, r1, #1           /* CYCCNTENA */
+str  r1, [r0]
+ldr  r0, =DWT_CYCCNT_REG
+ldr  r12, [r0]            /* r12 = entry time stamp */
+mov  r0, #0
+mov  r1, #0
+
 /*******************************************/
 /* Set vector table address in RAM         */
 /*******************************************/
 ldr  r0, =VTOR_REG
-ldr  r1, =OsCfg_Hal_Core_OsCore0_VectorTable
+ldr  r1, =\vtable
 ldr  r2, =(1 << 29)
 orr  r1, r2 /* r1 = r1 | r2 */
 str  r1,[r0]
@@ -43,9 +94,35 @@ str  r1,[r0]
 /*******************************************/
 /* Set stack pointer                       */
 /*******************************************/
-ldr  r0, =__StackTop
+ldr  r0, =\stack
 msr MSP, r0
 
+/*******************************************/
+/* Store entry time stamp                  */
+/*******************************************/
+ldr  r0, =STARTUP_au_CoreKpi + (8 * \core)
+str  r12, [r0]
+
+/*******************************************/
+/* Reset own boot barrier flag             */
+/*******************************************/
+ldr  r0, =STARTUP_au_CoreReady + (4 * \core)
+mov  r1, #0
+str  r1, [r0]
+dmb
+
+.if (\core == 0) && STARTUP_EARLY_RELEASE
+/*******************************************/
+/* Release secondaries, their flags are    */
+/* reset first as they are still held      */
+/*******************************************/
+ldr  r0, =STARTUP_au_CoreReady
+str  r1, [r0, #4]
+str  r1, [r0, #8]
+dmb
+bl Startup_ReleaseSecondaryCores
+.endif
+
 /*******************************************/
 /* FP register setup                       */
 /*******************************************/
@@ -54,19 +131,120 @@ bl SystemInit
 /*******************************************/
 /* Initialize TCM region                   */
 /*******************************************/
-  ldr  r2, =0x20000000
-  ldr  r3, =0x20010000
+bl Startup_ClearTCM
 
-FillZeroTCM_c0:
-  stm   r2!,{r4-r11}
-  cmp   r2, r3
-  bcc   FillZeroTCM_c0
+.if STARTUP_CORE_DATA_INIT
+/*******************************************/
+/* Core specific data initialization       */
+/*******************************************/
+mov  r0, #\core
+bl Startup_CoreDataInit
+.endif
+
+/*******************************************/
+/* Store KPI, signal boot barrier          */
+/*******************************************/
+ldr  r0, =DWT_CYCCNT_REG
+ldr  r1, [r0]
+ldr  r0, =STARTUP_au_CoreKpi + (8 * \core) + 4
+str  r1, [r0]
+ldr  r0, =STARTUP_au_CoreReady + (4 * \core)
+ldr  r1, =STARTUP_CORE_READY
+dmb
+str  r1, [r0]
+dsb
+sev
 
 /*******************************************/
 /* Call Main Routine                       */
 /*******************************************/
-bl main
+bl \entry
+.endm
+
+/******************************************************************/
+/* Clear the core local TCM, 32 byte per store                    */
+/* Does not use the stack (it may be located in the TCM),         */
+/* clobbers r2-r11. STARTUP_v_ZeroInit (Startup_MemInit) is not   */
+/* used here because it saves registers on the stack. Further RAM */
+/* regions are initialized via Startup_CoreDataInit.              */
+/* Called by all cores: section .startup_common must be mapped to */
+/* memory executable by every core.                               */
+/******************************************************************/
+.section ".startup_common","ax"
+.syntax unified
+.thumb
+.align 2
+.thumb_func
+.globl Startup_ClearTCM
+Startup_ClearTCM:
+  mov   r4,  #0
+  mov   r5,  #0
+  mov   r6,  #0
+  mov   r7,  #0
+  mov   r8,  #0
+  mov   r9,  #0
+  mov   r10, #0
+  mov   r11, #0
+  ldr   r2, =TCM_START
+  ldr   r3, =TCM_END
+
+FillZeroTCM:
+  stm   r2!,{r4-r11}
+  cmp   r2, r3
+  bcc   FillZeroTCM
+  bx    lr
+.ltorg
+
+/******************************************************************/
+/* Boot barrier: void STARTUP_v_WaitCoresReady(uint32 u_CoreMask) */
+/* Waits until all cores in u_CoreMask (bit n = core n) reached   */
+/* their main routine.                                            */
+/******************************************************************/
+.align 2
+.thumb_func
+.globl STARTUP_v_WaitCoresReady
+STARTUP_v_WaitCoresReady:
+  push  {r4, lr}
+  ldr   r4, =STARTUP_CORE_READY
+WaitCores_Loop:
+  ldr   r1, =STARTUP_au_CoreReady
+  mov   r2, r0            /* r2 = cores still to check */
+WaitCores_Check:
+  cbz   r2, WaitCores_Done
+  rbit  r3, r2
+  clz   r3, r3            /* r3 = lowest pending core */
+  ldr   r12, [r1, r3, lsl #2]
+  cmp   r12, r4
+  bne   WaitCores_Sleep
+  mov   r12, #1
+  lsl   r12, r12, r3
+  bic   r2, r2, r12
+  b     WaitCores_Check
+WaitCores_Sleep:
+  wfe
+  b     WaitCores_Loop
+WaitCores_Done:
+  dmb
+  pop   {r4, pc}
+.ltorg
+
+/******************************************************************/
+/* Core M7_0 startup code                                         */
+/******************************************************************/
+.globl OsCfg_Hal_Core_OsCore0_VectorTable
+.section ".startup_c0","ax"
+.syntax unified
+.thumb
 
+.align 2
+.globl CATCH_CORE_RESET
+
+.globl Reset_Handler
+Reset_Handler:
+.globl _start
+_start:
+STARTUP_CORE_INIT OsCfg_Hal_Core_OsCore0_VectorTable, __StackTop, 0, main
+.ltorg
 
 /******************************************************************/
 /* Core M7_1 startup code                                         */
@@ -75,66 +253,15 @@ bl main
 .section ".startup_c1","ax"
 .thumb
 
-.set VTOR_REG, 0xE000ED08
 .align 2
 .globl CATCH_CORE_RESET
 
-.globl Reset_Handler_Core1 
+.globl Reset_Handler_Core1
 Reset_Handler_Core1:
 .globl _start_c1
 _start_c1:
-/*******************************************/
-/* Clear General Purpose Registers         */
-/*******************************************/
- mov   r0,  #0
- mov   r1,  #0
- mov   r2,  #0
- mov   r3,  #0
- mov   r4,  #0
- mov   r5,  #0
- mov   r6,  #0
- mov   r7,  #0
- mov   r8,  #0
- mov   r9,  #0
- mov   r10, #0
- mov   r11, #0
- 
-/*******************************************/
-/* Set vector table address in RAM         */
-/*******************************************/
-ldr  r0, =VTOR_REG
-ldr  r1, =OsCfg_Hal_Core_OsCore1_VectorTable
-ldr  r2, =(1 << 29)
-orr  r1, r2 /* r1 = r1 | r2 */
-str  r1,[r0]
-
-/*******************************************/
-/* Set stack pointer                       */
-/*******************************************/
-ldr  r0, =__StackTop_c1
-msr MSP, r0
-
-/*******************************************/
-/* FP register setup                       */
-/*******************************************/
-bl SystemInit
-
-/*******************************************/
-/* Initialize TCM region                   */
-/*******************************************/
-  ldr  r2, =0x20000000
-  ldr  r3, =0x20010000
-
-FillZeroTCM_c1:
-  stm   r2!,{r4-r11}
-  cmp   r2, r3
-  bcc   FillZeroTCM_c1
-
-/*******************************************/
-/* Call Main Routine                       */
-/*******************************************/
-bl main_c1
-
+STARTUP_CORE_INIT OsCfg_Hal_Core_OsCore1_VectorTable, __StackTop_c1, 1, main_c1
+.ltorg
 
 /******************************************************************/
 /* Core M7_2 startup code                                         */
@@ -143,7 +270,6 @@ bl main_c1
 .section ".startup_c2","ax"
 .thumb
 
-.set VTOR_REG, 0xE000ED08
 .align 2
 .globl CATCH_CORE_RESET
 
@@ -151,54 +277,5 @@ bl main_c1
 Reset_Handler_Core2:
 .globl _start_c2
 _start_c2:
-/*******************************************/
-/* Clear General Purpose Registers         */
-/*******************************************/
- mov   r0,  #0
- mov   r1,  #0
- mov   r2,  #0
- mov   r3,  #0
- mov   r4,  #0
- mov   r5,  #0
- mov   r6,  #0
- mov   r7,  #0
- mov   r8,  #0
- mov   r9,  #0
- mov   r10, #0
- mov   r11, #0
- 
-/*******************************************/
-/* Set vector table address in RAM         */
-/*******************************************/
-ldr  r0, =VTOR_REG
-ldr  r1, =OsCfg_Hal_Core_OsCore2_VectorTable
-ldr  r2, =(1 << 29)
-orr  r1, r2 /* r1 = r1 | r2 */
-str  r1,[r0]
-
-/*******************************************/
-/* Set stack pointer                       */
-/*******************************************/
-ldr  r0, =__StackTop_c2
-msr MSP, r0
-
-/*******************************************/
-/* FP register setup                       */
-/*******************************************/
-bl SystemInit
-
-/*******************************************/
-/* Initialize TCM region                   */
-/*******************************************/
-  ldr  r2, =0x20000000
-  ldr  r3, =0x20010000
-
-FillZeroTCM_c2:
-  stm   r2!,{r4-r11}
-  cmp   r2, r3
-  bcc   FillZeroTCM_c2
-
-/*******************************************/
-/* Call Main Routine                       */
-/*******************************************/
-bl main_c2
+STARTUP_CORE_INIT OsCfg_Hal_Core_OsCore2_VectorTable, __StackTop_c2, 2, main_c2
+.ltorg
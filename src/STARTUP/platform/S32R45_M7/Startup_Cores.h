@@ -0,0 +1,60 @@
+// Copyright (C) Continental AG
+// All Rights Reserved
+// COMPONENT: STARTUP
+/// \file Startup_Cores.h
+/// \brief Boot barrier and boot KPI of the S32R45 M7 cores (Startup.s)
+
+#ifndef STARTUP_CORES_H
+#define STARTUP_CORES_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include <Std_Types.h>
+
+/// Number of M7 cores handled by Startup.s
+#define STARTUP_CORE_CNT    (3u)
+
+/// Value of STARTUP_au_CoreReady[core] once the core has finished its startup code
+#define STARTUP_CORE_READY  (0x52454459u)
+
+/// Ready flag per core, written by Startup.s right before the main routine of the core is called.
+/// Each core resets its own flag at reset entry. Flags of cores that are still held in reset are
+/// only reset by core 0 with STARTUP_EARLY_RELEASE, otherwise the code releasing them in main
+/// has to write 0 to their flags first.
+/// Located in section .startup_shared (shared, non cached SRAM, not cleared by the C runtime).
+extern volatile uint32 STARTUP_au_CoreReady[STARTUP_CORE_CNT];
+
+/// Boot KPI per core: [core][0] DWT cycle count at reset entry, [core][1] before the main routine.
+/// The cycle counters are core local, only differences within one core are meaningful.
+extern volatile uint32 STARTUP_au_CoreKpi[STARTUP_CORE_CNT][2];
+
+/// @brief    Boot barrier for the M7 cores
+/// @pre      Secondary cores are released (by Startup_ReleaseSecondaryCores or by main).
+/// @post     All requested cores finished their startup code.
+/// @param    u_CoreMask  bit n set waits for core n
+/// @return   none
+/// @globals  STARTUP_au_CoreReady
+void STARTUP_v_WaitCoresReady(uint32 u_CoreMask);
+
+/// @brief    Releases the secondary cores from core 0 before its TCM init (integration specific).
+///           Only called when Startup.s is assembled with --defsym STARTUP_EARLY_RELEASE=1.
+/// @pre      none
+/// @post     Secondary cores are running their startup code concurrently with core 0.
+/// @return   none
+void Startup_ReleaseSecondaryCores(void);
+
+/// @brief    Core specific data initialization (integration specific, e.g. STARTUP_v_InitRegions).
+///           Only called when Startup.s is assembled with --defsym STARTUP_CORE_DATA_INIT=1.
+/// @pre      TCM of the core is cleared, stack is set.
+/// @post     none
+/// @param    u_Core  index of the calling core
+/// @return   none
+void Startup_CoreDataInit(uint32 u_Core);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STARTUP_CORES_H
@@ -38,10 +38,16 @@
  *
 */
 #include "startup.h"
+#include "Startup_MemInit.h"
+#include "Startup_Ctors.h"
+#include "Startup_Sim.h"
 
 static inline void REG32(const unsigned int address,const unsigned int value)
 {
-#ifdef __GTEST_SWITCH__ /* means GTEST */
+#if defined(__GTEST_SWITCH__) && defined(STARTUP_SIM_REG_ACCESS)
+  /* Host harness simulates the register blocks */
+  STARTUP_v_SimWrite32(address, value);
+#elif defined(__GTEST_SWITCH__) /* means GTEST */
   /* Gtest cannot access memory locations */
   unsigned int varRegister;
   varRegister = value;
@@ -66,144 +72,91 @@ extern void (*__INIT_ARRAY_END__[])(void);
 #include "Startup_Memmap.h"
 #undef STARTUP_MEMMAP_H
 
-/*  Declarations  */
-/**
- * \brief  TEX[2:0], C and B values.
- *     CSL_ArmR5MemAttr is used as index here.
- *     gMemAttr[x][0]: TEX[2:0] values
- *     gMemAttr[x][1]: C bit value
- *     gMemAttr[x][2]: B bit value
- */
-static const unsigned int gMemAttr[CSL_ARM_R5_MEM_ATTR_MAX][3U] =
+/// Register values (base address, size/enable, access control) of one MPU region.
+typedef struct
 {
-/*  TEX[2:0], C,   B bits */
-  {   0x0U,   0x0U,  0x0U,}, /* Strongly-ordered.*/
-  {   0x0U,   0x0U,  0x1U,}, /* Shareable Device.*/
-  {   0x0U,   0x1U,  0x0U,}, /* Outer and Inner write-through, no write-allocate. */
-  {   0x0U,   0x1U,  0x1U,}, /* Outer and Inner write-back, no write-allocate. */
-  {   0x1U,   0x0U,  0x0U,}, /* Outer and Inner Non-cacheable. */
-  {   0x1U,   0x1U,  0x1U,}, /* Outer and Inner write-back, write-allocate.*/
-  {   0x2U,   0x0U,  0x0U,}, /* Non-shareable Device.*/
-};
-
-static const CSL_ArmR5MpuRegionCfg gCslR5MpuCfg[CSL_ARM_R5F_MPU_REGIONS_MAX] =
+  unsigned int baseAddrRegVal;
+  unsigned int sizeRegVal;
+  unsigned int accessCtrlRegVal;
+} t_STARTUP_MpuRegionRegs;
+
+/// Size and enable register value of a region.
+#define STARTUP_MPU_SZEN(enable, size, subRegionEnable) \
+  (((enable) << CSL_ARM_R5_MPU_REGION_SZEN_EN_SHIFT) | \
+   ((size) << CSL_ARM_R5_MPU_REGION_SZEN_SZ_SHIFT) | \
+   ((subRegionEnable) << CSL_ARM_R5_MPU_REGION_SZEN_SRD_SHIFT))
+
+/// TEX, C and B bits of a cacheable region with the given inner/outer cache policy.
+#define STARTUP_MPU_CACHED(cachePolicy) \
+  (((4U | (cachePolicy)) << CSL_ARM_R5_MPU_REGION_AC_TEX_SHIFT) | \
+   ((cachePolicy) << CSL_ARM_R5_MPU_REGION_AC_CB_SHIFT))
+
+/// TEX[2:0], C and B values of the memory attributes of non-cacheable regions (gMemAttr),
+/// the CSL_ArmR5MemAttr value is the index.
+/*                              TEX[2:0], C,   B bits */
+#define STARTUP_MPU_MEM_ATTR_0    0x0U,   0x0U,  0x0U   /* Strongly-ordered.*/
+#define STARTUP_MPU_MEM_ATTR_1    0x0U,   0x0U,  0x1U   /* Shareable Device.*/
+#define STARTUP_MPU_MEM_ATTR_2    0x0U,   0x1U,  0x0U   /* Outer and Inner write-through, no write-allocate. */
+#define STARTUP_MPU_MEM_ATTR_3    0x0U,   0x1U,  0x1U   /* Outer and Inner write-back, no write-allocate. */
+#define STARTUP_MPU_MEM_ATTR_4    0x1U,   0x0U,  0x0U   /* Outer and Inner Non-cacheable. */
+#define STARTUP_MPU_MEM_ATTR_5    0x1U,   0x1U,  0x1U   /* Outer and Inner write-back, write-allocate.*/
+#define STARTUP_MPU_MEM_ATTR_6    0x2U,   0x0U,  0x0U   /* Non-shareable Device.*/
+
+/// Access control bits of one gMemAttr entry. The C column is written to the B bit and the
+/// B column to the C bit, as by the TI CSL MPU setup this table is taken from.
+#define STARTUP_MPU_TEXCB(tex, c, b) \
+  (((tex) << CSL_ARM_R5_MPU_REGION_AC_TEX_SHIFT) | \
+   ((c) << CSL_ARM_R5_MPU_REGION_AC_B_SHIFT) | \
+   ((b) << CSL_ARM_R5_MPU_REGION_AC_C_SHIFT))
+#define STARTUP_MPU_MEM_ATTR(entry) STARTUP_MPU_TEXCB(entry)
+
+/// TEX, C and B bits of a non-cacheable region, memAttr (CSL_ArmR5MemAttr) selects the gMemAttr entry.
+#define STARTUP_MPU_UNCACHED(memAttr) \
+  (((memAttr) == 1U) ? STARTUP_MPU_MEM_ATTR(STARTUP_MPU_MEM_ATTR_1) : \
+   ((memAttr) == 2U) ? STARTUP_MPU_MEM_ATTR(STARTUP_MPU_MEM_ATTR_2) : \
+   ((memAttr) == 3U) ? STARTUP_MPU_MEM_ATTR(STARTUP_MPU_MEM_ATTR_3) : \
+   ((memAttr) == 4U) ? STARTUP_MPU_MEM_ATTR(STARTUP_MPU_MEM_ATTR_4) : \
+   ((memAttr) == 5U) ? STARTUP_MPU_MEM_ATTR(STARTUP_MPU_MEM_ATTR_5) : \
+   ((memAttr) == 6U) ? STARTUP_MPU_MEM_ATTR(STARTUP_MPU_MEM_ATTR_6) : \
+                       STARTUP_MPU_MEM_ATTR(STARTUP_MPU_MEM_ATTR_0))
+
+/// Register triplet of a region.
+#define STARTUP_MPU_REGION(baseAddr, sizeRegVal, exeNever, accessPermission, shareable, memBits) \
+  { ((baseAddr) & CSL_ARM_R5_MPU_REGION_BASE_ADDR_MASK), \
+    (sizeRegVal), \
+    (((exeNever) << CSL_ARM_R5_MPU_REGION_AC_XN_SHIFT) | \
+     ((accessPermission) << CSL_ARM_R5_MPU_REGION_AC_AP_SHIFT) | \
+     ((shareable) << CSL_ARM_R5_MPU_REGION_AC_S_SHIFT) | (memBits)) }
+
+/// MPU register values, index is the region number. Regions without entry are disabled.
+static const t_STARTUP_MpuRegionRegs gMpuRegionRegs[CSL_ARM_R5F_MPU_REGIONS_MAX] =
 {
-  {
-  // PRQA S 1053      ++ //date:2022-10-08, reviewer:uif31319, reason: ADAS C standard is C99, but QAC configurations always seem to assume C90
   /* Region 0 configuration: complete 32 bit address space = 4Gbits */
-    .regionId         = 0U,
-    .enable           = 1U,
-    .baseAddr         = 0x0U,
-    .size             = CSL_ARM_R5_MPU_REGION_SIZE_4GB,
-    .subRegionEnable  = CSL_ARM_R5_MPU_SUB_REGION_ENABLE_ALL,
-    .exeNeverControl  = 1U,
-    .accessPermission = CSL_ARM_R5_ACC_PERM_PRIV_USR_RD_WR,
-    .shareable        = 0U,
-    .cacheable        = 0U,
-    .cachePolicy      = 0U,
-    .memAttr          = 0U,
-  },
-  {
-    /* Region 1 configuration: 1MB L3 */
-    .regionId         = 1U,
-    .enable           = 1U,
-    .baseAddr         = 0x88000000U,
-    .size             = CSL_ARM_R5_MPU_REGION_SIZE_4MB,
-    .subRegionEnable  = CSL_ARM_R5_MPU_SUB_REGION_ENABLE_ALL,
-    .exeNeverControl  = 0U,
-    .accessPermission = CSL_ARM_R5_ACC_PERM_PRIV_USR_RD_WR,
-    .shareable        = 0U,
-    .cacheable        = 1U,
-    .cachePolicy      = CSL_ARM_R5_CACHE_POLICY_WB_WA,
-    .memAttr          = 0U,
-  },
-  {
-    /* Region 2 configuration: 64KB L3 uncached */
-    .regionId         = 2U,
-    .enable           = 1U,
-    .baseAddr         = 0x88100000U,
-    .size             = CSL_ARM_R5_MPU_REGION_SIZE_64KB,
-    .subRegionEnable  = CSL_ARM_R5_MPU_SUB_REGION_ENABLE_ALL,
-    .exeNeverControl  = 0U,
-    .accessPermission = CSL_ARM_R5_ACC_PERM_PRIV_USR_RD_WR,
-    .shareable        = 1U,
-    .cacheable        = 0U,
-    .cachePolicy      = CSL_ARM_R5_CACHE_POLICY_NON_CACHEABLE,
-    .memAttr          = CSL_ARM_R5_MEM_ATTR_STRONGLY_NON_CACHED,
-  },
-  {
-    /* Region 3 configuration: 32 KB TCMA */
-    .regionId         = 3U,
-    .enable           = 1U,
-    .baseAddr         = 0x00000000,
-    .size             = CSL_ARM_R5_MPU_REGION_SIZE_32KB,
-    .subRegionEnable  = CSL_ARM_R5_MPU_SUB_REGION_ENABLE_ALL,
-    .exeNeverControl  = 0U,
-    .accessPermission = CSL_ARM_R5_ACC_PERM_PRIV_USR_RD_WR,
-    .shareable        = 0U,
-    .cacheable        = 1U,
-    .cachePolicy      = CSL_ARM_R5_CACHE_POLICY_WB_WA,
-    .memAttr          = 0U,
-  },
-  {
-    /* Region 4 configuration: 32 KB  TCMB */
-    .regionId         = 4U,
-    .enable           = 1U,
-    .baseAddr         = 0x00080000,
-    .size             = CSL_ARM_R5_MPU_REGION_SIZE_32KB,
-    .subRegionEnable  = CSL_ARM_R5_MPU_SUB_REGION_ENABLE_ALL,
-    .exeNeverControl  = 0U,
-    .accessPermission = CSL_ARM_R5_ACC_PERM_PRIV_USR_RD_WR,
-    .shareable        = 0U,
-    .cacheable        = 1U,
-    .cachePolicy      = CSL_ARM_R5_CACHE_POLICY_WB_WA,
-    .memAttr          = 0U,
-  },
-  {
-    /* Region 5 configuration: 1 MB L2 RAM */
-    .regionId         = 5U,
-    .enable           = 1U,
-    .baseAddr         = 0x10200000,
-    .size             = CSL_ARM_R5_MPU_REGION_SIZE_1MB,
-    .subRegionEnable  = CSL_ARM_R5_MPU_SUB_REGION_ENABLE_ALL,
-    .exeNeverControl  = 0U,
-    .accessPermission = CSL_ARM_R5_ACC_PERM_PRIV_USR_RD_WR,
-    .shareable        = 0U,
-    .cacheable        = 1U,
-    .cachePolicy      = CSL_ARM_R5_CACHE_POLICY_WB_WA,
-    .memAttr          = 0U,
-  },
-  {
-    /* Region 6 configuration: 64KB L2 uncached*/
-    .regionId         = 6U,
-    .enable           = 1U,
-    .baseAddr         = 0x10200000,
-    .size             = CSL_ARM_R5_MPU_REGION_SIZE_64KB,
-    .subRegionEnable  = CSL_ARM_R5_MPU_SUB_REGION_ENABLE_ALL,
-    .exeNeverControl  = 0U,
-    .accessPermission = CSL_ARM_R5_ACC_PERM_PRIV_USR_RD_WR,
-    .shareable        = 1U,
-    .cacheable        = 0U,
-    .cachePolicy      = CSL_ARM_R5_CACHE_POLICY_NON_CACHEABLE,
-    .memAttr          = CSL_ARM_R5_MEM_ATTR_STRONGLY_NON_CACHED,
-  },
-  {
-    /* Region 7 configuration: 64KB L3 */
-    .regionId         = 7U,
-    .enable           = 1U,
-    .baseAddr         = 0x88180000U,
-    .size             = CSL_ARM_R5_MPU_REGION_SIZE_64KB,
-    .subRegionEnable  = CSL_ARM_R5_MPU_SUB_REGION_ENABLE_ALL,
-    .exeNeverControl  = 0U,
-    .accessPermission = CSL_ARM_R5_ACC_PERM_PRIV_USR_RD_WR,
-    .shareable        = 0U,
-    .cacheable        = 1U,
-    .cachePolicy      = CSL_ARM_R5_CACHE_POLICY_WB_WA,
-    .memAttr          = 0U,
-  }
-  // PRQA S 1053 --
+  STARTUP_MPU_REGION(0x0U, STARTUP_MPU_SZEN(1U, CSL_ARM_R5_MPU_REGION_SIZE_4GB, CSL_ARM_R5_MPU_SUB_REGION_ENABLE_ALL),
+                     1U, CSL_ARM_R5_ACC_PERM_PRIV_USR_RD_WR, 0U, STARTUP_MPU_UNCACHED(0U)),
+  /* Region 1 configuration: 1MB L3 */
+  STARTUP_MPU_REGION(0x88000000U, STARTUP_MPU_SZEN(1U, CSL_ARM_R5_MPU_REGION_SIZE_4MB, CSL_ARM_R5_MPU_SUB_REGION_ENABLE_ALL),
+                     0U, CSL_ARM_R5_ACC_PERM_PRIV_USR_RD_WR, 0U, STARTUP_MPU_CACHED(CSL_ARM_R5_CACHE_POLICY_WB_WA)),
+  /* Region 2 configuration: 64KB L3 uncached */
+  STARTUP_MPU_REGION(0x88100000U, STARTUP_MPU_SZEN(1U, CSL_ARM_R5_MPU_REGION_SIZE_64KB, CSL_ARM_R5_MPU_SUB_REGION_ENABLE_ALL),
+                     0U, CSL_ARM_R5_ACC_PERM_PRIV_USR_RD_WR, 1U, STARTUP_MPU_UNCACHED(CSL_ARM_R5_MEM_ATTR_STRONGLY_NON_CACHED)),
+  /* Region 3 configuration: 32 KB TCMA */
+  STARTUP_MPU_REGION(0x00000000U, STARTUP_MPU_SZEN(1U, CSL_ARM_R5_MPU_REGION_SIZE_32KB, CSL_ARM_R5_MPU_SUB_REGION_ENABLE_ALL),
+                     0U, CSL_ARM_R5_ACC_PERM_PRIV_USR_RD_WR, 0U, STARTUP_MPU_CACHED(CSL_ARM_R5_CACHE_POLICY_WB_WA)),
+  /* Region 4 configuration: 32 KB  TCMB */
+  STARTUP_MPU_REGION(0x00080000U, STARTUP_MPU_SZEN(1U, CSL_ARM_R5_MPU_REGION_SIZE_32KB, CSL_ARM_R5_MPU_SUB_REGION_ENABLE_ALL),
+                     0U, CSL_ARM_R5_ACC_PERM_PRIV_USR_RD_WR, 0U, STARTUP_MPU_CACHED(CSL_ARM_R5_CACHE_POLICY_WB_WA)),
+  /* Region 5 configuration: 1 MB L2 RAM */
+  STARTUP_MPU_REGION(0x10200000U, STARTUP_MPU_SZEN(1U, CSL_ARM_R5_MPU_REGION_SIZE_1MB, CSL_ARM_R5_MPU_SUB_REGION_ENABLE_ALL),
+                     0U, CSL_ARM_R5_ACC_PERM_PRIV_USR_RD_WR, 0U, STARTUP_MPU_CACHED(CSL_ARM_R5_CACHE_POLICY_WB_WA)),
+  /* Region 6 configuration: 64KB L2 uncached*/
+  STARTUP_MPU_REGION(0x10200000U, STARTUP_MPU_SZEN(1U, CSL_ARM_R5_MPU_REGION_SIZE_64KB, CSL_ARM_R5_MPU_SUB_REGION_ENABLE_ALL),
+                     0U, CSL_ARM_R5_ACC_PERM_PRIV_USR_RD_WR, 1U, STARTUP_MPU_UNCACHED(CSL_ARM_R5_MEM_ATTR_STRONGLY_NON_CACHED)),
+  /* Region 7 configuration: 64KB L3 */
+  STARTUP_MPU_REGION(0x88180000U, STARTUP_MPU_SZEN(1U, CSL_ARM_R5_MPU_REGION_SIZE_64KB, CSL_ARM_R5_MPU_SUB_REGION_ENABLE_ALL),
+                     0U, CSL_ARM_R5_ACC_PERM_PRIV_USR_RD_WR, 0U, STARTUP_MPU_CACHED(CSL_ARM_R5_CACHE_POLICY_WB_WA)),
   // PRQA S 0686 2 //date:2022-08-12, reviewer:uif31319,
-  // Not a problem. The array size is configured for maximum size(MPU registers) The memory used as per the MAP file is only for 8 elements
+  // Not a problem. The array size is configured for maximum size(MPU registers), remaining regions are disabled
 };
 
 #define STARTUP_STOP_SEC_CONST_ASIL_B_UNSPECIFIED
@@ -225,6 +178,20 @@ extern unsigned char __SVC_STACK_END;
 extern unsigned char __USER_STACK_START;
 extern unsigned char __USER_STACK_END;
 
+#define STARTUP_START_SEC_CONST_ASIL_B_UNSPECIFIED
+#include "Startup_Memmap.h"
+#undef STARTUP_MEMMAP_H
+
+/// RAM regions initialized by system_pre_init()
+static const t_STARTUP_MemRegion s_PreInitRegions[] =
+{
+  { &__BSS_START, &__BSS_END, NULL }   /* .bss: zero init */
+};
+
+#define STARTUP_STOP_SEC_CONST_ASIL_B_UNSPECIFIED
+#include "Startup_Memmap.h"
+#undef STARTUP_MEMMAP_H
+
 extern void CSL_armR5StartupMpuEnable(unsigned int enable);
 extern void CSL_armR5StartupBREnable(unsigned int enable);
 extern void CSL_armR5StartupMpuCfgRegion(unsigned int regionNum, unsigned int baseAddrRegVal, unsigned int sizeRegVal, unsigned int accessCtrlRegVal);
@@ -345,19 +312,16 @@ static void call_ctors(void)
   // PRQA S 0306 1
   const unsigned int u_noofctors = ((unsigned int)__INIT_ARRAY_END__ - (unsigned int)__INIT_ARRAY_LIST__) / sizeof(unsigned int);
   const unsigned int u_firstctorindex = 1U;
-  unsigned int     i;
 
   /*
-   * Loop through init_array and execute each constructor until end of list is hit.
+   * Execute the constructors of init_array in table order, NULL entries are skipped.
    * Please note that the first and the last entries that are from ctordtor.o are skipped
    * because those are not relevant.
    */
-  for (i=u_firstctorindex; i < (u_noofctors - u_firstctorindex); i++)
+  if (u_noofctors > (2U * u_firstctorindex))
   {
-    if (__INIT_ARRAY_LIST__[i] != (void*)0U)
-    {
-      __INIT_ARRAY_LIST__[i]();  // Call constructor
-    }
+    STARTUP_v_RunCtors(&__INIT_ARRAY_LIST__[u_firstctorindex], u_noofctors - (2U * u_firstctorindex),
+                       STARTUP_CTOR_ABSOLUTE, NULL);
   }
 }
 
@@ -365,17 +329,8 @@ static void call_ctors(void)
 /// @impl{L3_SWD_STARTUP_SYSTEMPREINIT}
 void system_pre_init(void) // PRQA S 1503 1 //date:2022-08-16, reviewer:uif31319, reason: functions are used in appropriate Projects.
 {
-  unsigned int i = 0U;
-  unsigned char *dst;
-
   /* Clear BSS section */
-  dst = &__BSS_START;
-  // PRQA S 2771 2 //date:2022-10-08, reviewer:uif31319,
-  //reason: Comparing well defined address by the linker this is a platform specific init sequence implementation(Non portable).
-  for (i=0; &(dst[i]) < &__BSS_END; i++)
-  {
-    dst[i] = 0U;
-  }
+  STARTUP_v_InitRegions(s_PreInitRegions, (uint32)(sizeof(s_PreInitRegions) / sizeof(s_PreInitRegions[0])));
 
   /*
    * Call the constructors of all global C++ variables
@@ -387,8 +342,7 @@ void system_pre_init(void) // PRQA S 1503 1 //date:2022-08-16, reviewer:uif31319
 
 static void CSL_armR5MPUCfg(void)
 {
-  unsigned int loopCnt = 0U;
-  unsigned int baseAddrRegVal = 0U, sizeRegVal = 0U, accessCtrlRegVal = 0U, tex;
+  unsigned int loopCnt;
 
   CSL_armR5StartupCacheInvalidateAllCache();   /* Invalidate caches */
   CSL_armR5StartupCacheEnableDCache(0);        /* Disable D-cache */
@@ -396,69 +350,16 @@ static void CSL_armR5MPUCfg(void)
   /* Disable MPU */
   CSL_armR5StartupMpuEnable(0U);
 
-  /* Disable all MPU regions */
-  for (loopCnt=0U ; loopCnt < CSL_ARM_R5F_MPU_REGIONS_MAX; loopCnt++)
-  {
-    CSL_armR5StartupMpuCfgRegion(loopCnt,
-                   baseAddrRegVal,
-                   sizeRegVal,
-                   accessCtrlRegVal);
-  }
-
   /* Disable Default (Background) MPU Regions */
   CSL_armR5StartupBREnable(0U);
 
-  /* Configure MPU regions only for provided configuration */
+  /* Program all MPU regions in one pass, unused regions are written as disabled */
   for (loopCnt=0U; loopCnt < CSL_ARM_R5F_MPU_REGIONS_MAX; loopCnt++)
   {
-    if (CSL_ARM_R5_MPU_REGION_SIZE_32B <= gCslR5MpuCfg[loopCnt].size)
-    {
-      baseAddrRegVal   = ( gCslR5MpuCfg[loopCnt].baseAddr &
-                  CSL_ARM_R5_MPU_REGION_BASE_ADDR_MASK);
-      // PRQA S 2985 2 //date:2022-10-08, reviewer:uif31319, reason: redundant shift operation but increases the code readability.
-      sizeRegVal     = ( gCslR5MpuCfg[loopCnt].enable <<
-                  CSL_ARM_R5_MPU_REGION_SZEN_EN_SHIFT);
-      sizeRegVal     |= ( gCslR5MpuCfg[loopCnt].size <<
-                  CSL_ARM_R5_MPU_REGION_SZEN_SZ_SHIFT);
-      sizeRegVal     |= ( gCslR5MpuCfg[loopCnt].subRegionEnable <<
-                  CSL_ARM_R5_MPU_REGION_SZEN_SRD_SHIFT);
-      accessCtrlRegVal = ( gCslR5MpuCfg[loopCnt].exeNeverControl <<
-                  CSL_ARM_R5_MPU_REGION_AC_XN_SHIFT);
-      accessCtrlRegVal |= ( gCslR5MpuCfg[loopCnt].accessPermission <<
-                  CSL_ARM_R5_MPU_REGION_AC_AP_SHIFT);
-      accessCtrlRegVal |= ( gCslR5MpuCfg[loopCnt].shareable <<
-                  CSL_ARM_R5_MPU_REGION_AC_S_SHIFT);
-
-      if (gCslR5MpuCfg[loopCnt].cacheable == 1U)
-      {
-        tex = 4U;
-        tex |= (gCslR5MpuCfg[loopCnt].cachePolicy);
-        accessCtrlRegVal |=
-                ( tex << CSL_ARM_R5_MPU_REGION_AC_TEX_SHIFT);
-        // PRQA S 2985 2 //date:2022-10-08, reviewer:uif31319, reason: redundant shift operation but increases the code readability.
-        accessCtrlRegVal |= ( gCslR5MpuCfg[loopCnt].cachePolicy <<
-                CSL_ARM_R5_MPU_REGION_AC_CB_SHIFT);
-      }
-      else
-      {
-        tex = gMemAttr[gCslR5MpuCfg[loopCnt].memAttr][0U];
-        accessCtrlRegVal |=
-                ( tex << CSL_ARM_R5_MPU_REGION_AC_TEX_SHIFT);
-        // PRQA S 2985 3 //date:2022-10-08, reviewer:uif31319, reason: redundant shift operation but increases the code readability.
-        accessCtrlRegVal |=
-                ( gMemAttr[gCslR5MpuCfg[loopCnt].memAttr][1U] <<
-                CSL_ARM_R5_MPU_REGION_AC_B_SHIFT);
-        accessCtrlRegVal |=
-                ( gMemAttr[gCslR5MpuCfg[loopCnt].memAttr][2U] <<
-                CSL_ARM_R5_MPU_REGION_AC_C_SHIFT);
-      }
-
-      /* configure MPU region here */
-      CSL_armR5StartupMpuCfgRegion(gCslR5MpuCfg[loopCnt].regionId,
-                     baseAddrRegVal,
-                     sizeRegVal,
-                     accessCtrlRegVal);
-    }
+    CSL_armR5StartupMpuCfgRegion(loopCnt,
+                   gMpuRegionRegs[loopCnt].baseAddrRegVal,
+                   gMpuRegionRegs[loopCnt].sizeRegVal,
+                   gMpuRegionRegs[loopCnt].accessCtrlRegVal);
   }
 
   CSL_armR5StartupCacheInvalidateAllCache();   /* Invalidate caches */
@@ -0,0 +1,129 @@
+// Copyright (C) Continental AG
+// All Rights Reserved
+// COMPONENT: STARTUP
+/// \file Startup_SimBackend.c
+/// \brief Simulated register blocks for the STARTUP host tests (Startup_Sim.h).
+///        Models the NVIC interrupt controller type and priority registers and the
+///        BASEPRI register of a Cortex-M4 with STARTUP_SIM_PRIO_BITS priority bits.
+///        Each access adds the latency of its block to the simulated time and is counted.
+
+#include <stdio.h>
+
+#include "Startup_Sim.h"
+#include "Startup_SimBackend.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define STARTUP_SIM_NVIC_ICTR   (0xE000E004uL)
+#define STARTUP_SIM_NVIC_IPR0   (0xE000E400uL)
+
+/// Implemented priority bits, the upper bits of each priority byte.
+#define STARTUP_SIM_PRIO_MASK   ((uint8)(0xFFu << (8u - STARTUP_SIM_PRIO_BITS)))
+
+/// Names of the register blocks in the report.
+static const char* const ap_SimBlkName[STARTUP_SIM_BLK_CNT] = { "nvic", "core", "other" };
+
+t_STARTUP_SimState STARTUP_s_Sim;
+
+static void v_SimRead(t_STARTUP_SimBlock e_Blk)
+{
+  STARTUP_s_Sim.as_Blk[e_Blk].u_Reads++;
+  STARTUP_s_Sim.u_Time_ns += STARTUP_s_Sim.as_Blk[e_Blk].u_ReadLatency_ns;
+}
+
+static void v_SimWrite(t_STARTUP_SimBlock e_Blk)
+{
+  STARTUP_s_Sim.as_Blk[e_Blk].u_Writes++;
+  STARTUP_s_Sim.u_Time_ns += STARTUP_s_Sim.as_Blk[e_Blk].u_WriteLatency_ns;
+}
+
+void STARTUP_v_SimReset(uint32 u_IctrLines)
+{
+  uint32 u_Idx;
+
+  STARTUP_s_Sim.u_Ictr    = u_IctrLines;
+  STARTUP_s_Sim.u_Basepri = 0u;
+  STARTUP_s_Sim.u_Time_ns = 0u;
+  for (u_Idx = 0u; u_Idx < STARTUP_SIM_IPR_CNT; u_Idx++)
+  {
+    STARTUP_s_Sim.au_Ipr[u_Idx] = 0u;
+  }
+  for (u_Idx = 0u; u_Idx < (uint32)STARTUP_SIM_BLK_CNT; u_Idx++)
+  {
+    STARTUP_s_Sim.as_Blk[u_Idx].u_Reads  = 0u;
+    STARTUP_s_Sim.as_Blk[u_Idx].u_Writes = 0u;
+  }
+}
+
+void STARTUP_v_SimSetLatency(t_STARTUP_SimBlock e_Blk, uint32 u_Read_ns, uint32 u_Write_ns)
+{
+  STARTUP_s_Sim.as_Blk[e_Blk].u_ReadLatency_ns  = u_Read_ns;
+  STARTUP_s_Sim.as_Blk[e_Blk].u_WriteLatency_ns = u_Write_ns;
+}
+
+void STARTUP_v_SimReport(const char* p_Function, uint64_t u_Host_ns)
+{
+  uint32 u_Idx;
+
+  printf("STARTUP_BENCH %s host_ns=%llu sim_ns=%u", p_Function, (unsigned long long)u_Host_ns,
+         (unsigned)STARTUP_s_Sim.u_Time_ns);
+  for (u_Idx = 0u; u_Idx < (uint32)STARTUP_SIM_BLK_CNT; u_Idx++)
+  {
+    printf(" %s_rd=%u %s_wr=%u", ap_SimBlkName[u_Idx], (unsigned)STARTUP_s_Sim.as_Blk[u_Idx].u_Reads,
+           ap_SimBlkName[u_Idx], (unsigned)STARTUP_s_Sim.as_Blk[u_Idx].u_Writes);
+  }
+  printf("\n");
+}
+
+void STARTUP_v_SimWrite32(uint32 u_Addr, uint32 u_Value)
+{
+  // no 32 bit register is writable in the model
+  (void)u_Addr;
+  (void)u_Value;
+  v_SimWrite(STARTUP_SIM_BLK_OTHER);
+}
+
+void STARTUP_v_SimWrite8(uint32 u_Addr, uint8 u_Value)
+{
+  if ((u_Addr >= STARTUP_SIM_NVIC_IPR0) && (u_Addr < (STARTUP_SIM_NVIC_IPR0 + STARTUP_SIM_IPR_CNT)))
+  {
+    STARTUP_s_Sim.au_Ipr[u_Addr - STARTUP_SIM_NVIC_IPR0] = u_Value & STARTUP_SIM_PRIO_MASK;
+    v_SimWrite(STARTUP_SIM_BLK_NVIC);
+  }
+  else
+  {
+    v_SimWrite(STARTUP_SIM_BLK_OTHER);
+  }
+}
+
+uint32 STARTUP_u_SimRead32(uint32 u_Addr)
+{
+  uint32 u_Value = 0u;
+
+  if (u_Addr == STARTUP_SIM_NVIC_ICTR)
+  {
+    u_Value = STARTUP_s_Sim.u_Ictr;
+    v_SimRead(STARTUP_SIM_BLK_NVIC);
+  }
+  else
+  {
+    v_SimRead(STARTUP_SIM_BLK_OTHER);
+  }
+  return u_Value;
+}
+
+uint8 STARTUP_u_SimSetBasepri(uint8 u_Value)
+{
+  // not implemented bits read as zero and ignore writes, the value is read back (MSR, MRS)
+  STARTUP_s_Sim.u_Basepri = u_Value & STARTUP_SIM_PRIO_MASK;
+  v_SimWrite(STARTUP_SIM_BLK_CORE);
+  v_SimRead(STARTUP_SIM_BLK_CORE);
+  return STARTUP_s_Sim.u_Basepri;
+}
+
+#ifdef __cplusplus
+}
+#endif
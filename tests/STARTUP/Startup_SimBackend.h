@@ -0,0 +1,78 @@
+// Copyright (C) Continental AG
+// All Rights Reserved
+// COMPONENT: STARTUP
+/// \file Startup_SimBackend.h
+/// \brief State of the simulated register blocks of the STARTUP host tests
+
+#ifndef STARTUP_SIMBACKEND_H
+#define STARTUP_SIMBACKEND_H
+
+#include <stdint.h>
+#include <Std_Types.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Number of priority bits implemented by the simulated core.
+#define STARTUP_SIM_PRIO_BITS   (4u)
+
+/// Number of simulated NVIC priority registers (ICTR 0..7 selects up to 256).
+#define STARTUP_SIM_IPR_CNT     (256u)
+
+/// Register blocks of the simulated core.
+typedef enum
+{
+  STARTUP_SIM_BLK_NVIC = 0,               ///< NVIC in the private peripheral bus (ICTR, IPR)
+  STARTUP_SIM_BLK_CORE,                   ///< core registers (BASEPRI)
+  STARTUP_SIM_BLK_OTHER,                  ///< addresses not modelled
+  STARTUP_SIM_BLK_CNT
+} t_STARTUP_SimBlock;
+
+/// Access latencies and statistics of one register block.
+typedef struct
+{
+  uint32 u_ReadLatency_ns;                ///< simulated time of one read
+  uint32 u_WriteLatency_ns;               ///< simulated time of one write
+  uint32 u_Reads;                         ///< number of reads
+  uint32 u_Writes;                        ///< number of writes
+} t_STARTUP_SimBlockState;
+
+/// Simulated register state and access statistics.
+typedef struct
+{
+  uint32 u_Ictr;                          ///< NVIC interrupt controller type register
+  uint8  u_Basepri;                       ///< BASEPRI core register
+  uint8  au_Ipr[STARTUP_SIM_IPR_CNT];     ///< NVIC priority registers
+  uint32 u_Time_ns;                       ///< simulated time spent in register accesses
+  t_STARTUP_SimBlockState as_Blk[STARTUP_SIM_BLK_CNT];
+} t_STARTUP_SimState;
+
+extern t_STARTUP_SimState STARTUP_s_Sim;
+
+/// @brief    Resets the simulated registers, the access statistics and the simulated time.
+///           The latencies are kept.
+/// @param    u_IctrLines  value of NVIC ICTR.INTLINESNUM
+/// @return   none
+void STARTUP_v_SimReset(uint32 u_IctrLines);
+
+/// @brief    Sets the access latencies of a register block.
+/// @param    e_Blk        register block
+/// @param    u_Read_ns    simulated time of one read
+/// @param    u_Write_ns   simulated time of one write
+/// @return   none
+void STARTUP_v_SimSetLatency(t_STARTUP_SimBlock e_Blk, uint32 u_Read_ns, uint32 u_Write_ns);
+
+/// @brief    Prints one result line of a startup function for CI:
+///           "STARTUP_BENCH <function> host_ns=.. sim_ns=.. <block>_rd=.. <block>_wr=.."
+/// @param    p_Function   name of the measured function
+/// @param    u_Host_ns    host time of the call
+/// @return   none
+void STARTUP_v_SimReport(const char* p_Function, uint64_t u_Host_ns);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // #ifndef STARTUP_SIMBACKEND_H
@@ -0,0 +1,32 @@
+// Copyright (C) Continental AG
+// All Rights Reserved
+// COMPONENT: STARTUP
+/// \file Std_Types.h
+/// \brief Host replacement of the AUTOSAR standard types for the STARTUP host tests
+
+#ifndef STD_TYPES_H
+#define STD_TYPES_H
+
+#include <stdint.h>
+
+typedef uint8_t  uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef int32_t  sint32;
+typedef uint8    boolean;
+typedef uint8    Std_ReturnType;
+
+#ifndef TRUE
+#define TRUE  (1u)
+#endif
+#ifndef FALSE
+#define FALSE (0u)
+#endif
+
+#define E_OK     ((Std_ReturnType)0u)
+#define E_NOT_OK ((Std_ReturnType)1u)
+
+#define STD_ON   (1u)
+#define STD_OFF  (0u)
+
+#endif // #ifndef STD_TYPES_H
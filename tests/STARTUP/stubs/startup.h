@@ -0,0 +1,23 @@
+// Copyright (C) Continental AG
+// All Rights Reserved
+// COMPONENT: STARTUP
+/// \file startup.h
+/// \brief Host replacement of the M4 startup interface for the STARTUP host tests
+
+#ifndef STARTUP_H
+#define STARTUP_H
+
+#include "Std_Types.h"
+
+// inline assembler of the target compiler, not executed on the host
+#define __as1(...)
+#define __as2(...)
+#define ___asm(...)
+
+/// Entry of the application, renamed to STARTUP_SimMain() for startup.c by the test build.
+int main(void);
+
+/// Called by the startup code on a configuration error.
+void STARTUP_v_ExceptionHandler(void);
+
+#endif // #ifndef STARTUP_H
@@ -0,0 +1,38 @@
+// Copyright (C) Continental AG
+// All Rights Reserved
+// COMPONENT: STARTUP
+/// \file startup_cfg.h
+/// \brief Memory init configuration of the M4 startup code for the STARTUP host tests
+
+#ifndef STARTUP_CFG_H
+#define STARTUP_CFG_H
+
+#include "Std_Types.h"
+
+/// Number of regions initialized with zero.
+#define ZERO_INIT_GROUPS_COUNT  (2u)
+
+/// Number of regions initialized from their ROM image.
+#define DATA_INIT_GROUPS_COUNT  (1u)
+
+/// Zero init region, [Start, End).
+typedef struct
+{
+  uint32 Start;
+  uint32 End;
+} MemArea;
+
+/// Data init region, [Start, End) is loaded from [Romstart, Romend).
+typedef struct
+{
+  uint32 Start;
+  uint32 End;
+  uint32 Romstart;
+  uint32 Romend;
+} RamMemArea;
+
+/// Regions are set up by the test at run time, inside the simulated RAM.
+extern MemArea    ZeroInit_Group[ZERO_INIT_GROUPS_COUNT];
+extern RamMemArea DataInit_Group[DATA_INIT_GROUPS_COUNT];
+
+#endif // #ifndef STARTUP_CFG_H
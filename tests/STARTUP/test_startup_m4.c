@@ -0,0 +1,188 @@
+// Copyright (C) Continental AG
+// All Rights Reserved
+// COMPONENT: STARTUP
+/// \file test_startup_m4.c
+/// \brief Host test of STARTUP_v_PreMainStartup() (M4) on the simulated register backend.
+///        Checks the zero and data init groups, the interrupt lock via BASEPRI and the NVIC
+///        priority registers, and that main() is called once. Reports the host time, the
+///        simulated register access time and the register accesses of the startup function
+///        and of the memory init kernels (STARTUP_BENCH lines).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/mman.h>
+
+#include "startup_cfg.h"
+#include "Startup_MemInit.h"
+#include "Startup_SimBackend.h"
+
+/// Size of the simulated RAM, mapped below 4 GiB as the startup code uses 32 bit addresses.
+#define TEST_RAM_SIZE       (0x1000u)
+#define TEST_RAM_HINT       (0x20000000uL)
+
+/// Return code for tests which cannot run on this host (ctest SKIP_RETURN_CODE).
+#define TEST_SKIP           (77)
+
+/// ICTR.INTLINESNUM of the simulated core: (2 + 1) * 32 interrupts.
+#define TEST_ICTR_LINES     (2u)
+
+/// Access latencies in ns of the simulated core at 100 MHz: PPB access 4 cycles, core register 1 cycle.
+#define TEST_NVIC_LATENCY   (40u)
+#define TEST_CORE_LATENCY   (10u)
+
+/// Size of the areas of the memory init kernel benchmark.
+#define TEST_BENCH_SIZE     (0x10000u)
+
+MemArea    ZeroInit_Group[ZERO_INIT_GROUPS_COUNT];
+RamMemArea DataInit_Group[DATA_INIT_GROUPS_COUNT];
+
+void STARTUP_v_PreMainStartup(void);
+
+static uint32 u_TestMainCalls;
+static uint32 u_TestErrors;
+
+// main() of the startup code
+int STARTUP_SimMain(void)
+{
+  u_TestMainCalls++;
+  return 0;
+}
+
+void STARTUP_v_ExceptionHandler(void)
+{
+  printf("FAIL: STARTUP_v_ExceptionHandler called\n");
+  exit(EXIT_FAILURE);
+}
+
+static void v_Check(int b_Ok, const char* p_What)
+{
+  if (!b_Ok)
+  {
+    printf("FAIL: %s\n", p_What);
+    u_TestErrors++;
+  }
+}
+
+static int b_IsFilled(const uint8* p_Mem, uint32 u_Len, uint8 u_Value);
+
+static uint64_t u_HostTime_ns(void)
+{
+  struct timespec s_Now;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &s_Now);
+  return ((uint64_t)s_Now.tv_sec * 1000000000uLL) + (uint64_t)s_Now.tv_nsec;
+}
+
+// benchmark of the memory init kernels, they do not access registers
+static void v_BenchMemInit(void)
+{
+  static uint32 au_Dst[TEST_BENCH_SIZE / 4u];
+  static uint32 au_Src[TEST_BENCH_SIZE / 4u];
+  uint64_t u_Start;
+
+  memset(au_Src, 0x5A, sizeof(au_Src));
+
+  STARTUP_v_SimReset(TEST_ICTR_LINES);
+  u_Start = u_HostTime_ns();
+  STARTUP_v_ZeroInit(au_Dst, &au_Dst[TEST_BENCH_SIZE / 4u]);
+  STARTUP_v_SimReport("STARTUP_v_ZeroInit", u_HostTime_ns() - u_Start);
+  v_Check(b_IsFilled((const uint8*)au_Dst, TEST_BENCH_SIZE, 0u), "benchmark area cleared");
+
+  STARTUP_v_SimReset(TEST_ICTR_LINES);
+  u_Start = u_HostTime_ns();
+  STARTUP_v_CopyInit(au_Dst, &au_Dst[TEST_BENCH_SIZE / 4u], au_Src);
+  STARTUP_v_SimReport("STARTUP_v_CopyInit", u_HostTime_ns() - u_Start);
+  v_Check(memcmp(au_Dst, au_Src, TEST_BENCH_SIZE) == 0, "benchmark area loaded");
+}
+
+static int b_IsFilled(const uint8* p_Mem, uint32 u_Len, uint8 u_Value)
+{
+  uint32 u_Idx;
+  int    b_Ret = 1;
+
+  for (u_Idx = 0u; u_Idx < u_Len; u_Idx++)
+  {
+    if (p_Mem[u_Idx] != u_Value)
+    {
+      b_Ret = 0;
+    }
+  }
+  return b_Ret;
+}
+
+int main(void)
+{
+  uint8* p_Ram;
+  uint32 u_Base;
+  uint32 u_Idx;
+  uint32 u_IprCnt = (TEST_ICTR_LINES + 1u) * 32u;
+  uint64_t u_Start;
+
+  p_Ram = (uint8*)mmap((void*)TEST_RAM_HINT, TEST_RAM_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if ((p_Ram == (uint8*)MAP_FAILED) || (((uintptr_t)p_Ram + TEST_RAM_SIZE) > 0xFFFFFFFFuL))
+  {
+    printf("SKIP: no memory below 4 GiB\n");
+    return TEST_SKIP;
+  }
+  u_Base = (uint32)(uintptr_t)p_Ram;
+  memset(p_Ram, 0xA5, TEST_RAM_SIZE);
+
+  // zero init: unaligned start and end, and a word aligned area
+  ZeroInit_Group[0].Start = u_Base + 0x001u;
+  ZeroInit_Group[0].End   = u_Base + 0x103u;
+  ZeroInit_Group[1].Start = u_Base + 0x200u;
+  ZeroInit_Group[1].End   = u_Base + 0x300u;
+
+  // data init: image in "ROM" at 0x800, loaded to 0x400
+  for (u_Idx = 0u; u_Idx < 0xC0u; u_Idx++)
+  {
+    p_Ram[0x800u + u_Idx] = (uint8)u_Idx;
+  }
+  DataInit_Group[0].Start    = u_Base + 0x400u;
+  DataInit_Group[0].End      = u_Base + 0x4C0u;
+  DataInit_Group[0].Romstart = u_Base + 0x800u;
+  DataInit_Group[0].Romend   = u_Base + 0x8C0u;
+
+  STARTUP_v_SimSetLatency(STARTUP_SIM_BLK_NVIC, TEST_NVIC_LATENCY, TEST_NVIC_LATENCY);
+  STARTUP_v_SimSetLatency(STARTUP_SIM_BLK_CORE, TEST_CORE_LATENCY, TEST_CORE_LATENCY);
+  STARTUP_v_SimReset(TEST_ICTR_LINES);
+
+  u_Start = u_HostTime_ns();
+  STARTUP_v_PreMainStartup();
+  STARTUP_v_SimReport("STARTUP_v_PreMainStartup", u_HostTime_ns() - u_Start);
+
+  v_Check(u_TestMainCalls == 1u, "main() called once");
+
+  v_Check(p_Ram[0x000u] == 0xA5u, "byte before zero area 0 untouched");
+  v_Check(b_IsFilled(&p_Ram[0x001u], 0x102u, 0u), "zero area 0 cleared");
+  v_Check(p_Ram[0x103u] == 0xA5u, "byte after zero area 0 untouched");
+  v_Check(b_IsFilled(&p_Ram[0x200u], 0x100u, 0u), "zero area 1 cleared");
+  v_Check(p_Ram[0x300u] == 0xA5u, "byte after zero area 1 untouched");
+
+  v_Check(memcmp(&p_Ram[0x400u], &p_Ram[0x800u], 0xC0u) == 0, "data area loaded from its image");
+  v_Check(p_Ram[0x4C0u] == 0xA5u, "byte after data area untouched");
+
+  // lowest implemented priority bit locks all interrupts
+  v_Check(STARTUP_s_Sim.u_Basepri == 0x10u, "BASEPRI set to the lowest implemented priority");
+  v_Check(STARTUP_s_Sim.as_Blk[STARTUP_SIM_BLK_NVIC].u_Writes == u_IprCnt, "one write per implemented priority register");
+  v_Check(STARTUP_s_Sim.as_Blk[STARTUP_SIM_BLK_NVIC].u_Reads == 1u, "ICTR read once");
+  v_Check(STARTUP_s_Sim.as_Blk[STARTUP_SIM_BLK_CORE].u_Writes == 2u, "BASEPRI probed and set");
+  for (u_Idx = 0u; u_Idx < u_IprCnt; u_Idx++)
+  {
+    v_Check(STARTUP_s_Sim.au_Ipr[u_Idx] == 0x10u, "priority register set to BASEPRI");
+  }
+  v_Check(STARTUP_s_Sim.au_Ipr[u_IprCnt] == 0u, "priority register above ICTR untouched");
+  v_Check((STARTUP_s_Sim.as_Blk[STARTUP_SIM_BLK_OTHER].u_Reads + STARTUP_s_Sim.as_Blk[STARTUP_SIM_BLK_OTHER].u_Writes) == 0u,
+          "no access outside the modelled registers");
+  v_Check(STARTUP_s_Sim.u_Time_ns == (((u_IprCnt + 1u) * TEST_NVIC_LATENCY) + (4u * TEST_CORE_LATENCY)),
+          "simulated time is the sum of the access latencies");
+
+  v_BenchMemInit();
+
+  (void)munmap(p_Ram, TEST_RAM_SIZE);
+
+  printf("%s: %u errors\n", (u_TestErrors == 0u) ? "PASS" : "FAIL", (unsigned)u_TestErrors);
+  return (u_TestErrors == 0u) ? EXIT_SUCCESS : EXIT_FAILURE;
+}